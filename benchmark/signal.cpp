@@ -0,0 +1,103 @@
+#include <lxgui/utils_light_signal.hpp>
+#include <lxgui/utils_signal.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace lxgui;
+
+namespace {
+
+// Prevents the compiler from optimizing the slots away
+volatile std::size_t sink = 0u;
+
+template<typename F>
+double measure_ns(std::size_t iterations, F&& func) {
+    using clock = std::chrono::steady_clock;
+
+    const auto start = clock::now();
+    for (std::size_t i = 0u; i < iterations; ++i)
+        func(i);
+    const auto end = clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() /
+           static_cast<double>(iterations);
+}
+
+template<typename Signal>
+double benchmark_trigger(std::size_t slot_count, std::size_t iterations) {
+    Signal                                sig;
+    std::vector<utils::scoped_connection> connections;
+
+    // Typical slot: captures a pointer and a string, like frame::register_event()
+    for (std::size_t i = 0u; i < slot_count; ++i) {
+        std::string name = "EVENT_" + std::to_string(i);
+        connections.push_back(sig.connect([name = std::move(name)](std::size_t value) {
+            sink = sink + value + name.size();
+        }));
+    }
+
+    return measure_ns(iterations, [&](std::size_t i) { sig(i); });
+}
+
+template<typename Signal>
+double benchmark_connect(std::size_t slot_count, std::size_t iterations) {
+    Signal sig;
+
+    return measure_ns(iterations, [&](std::size_t) {
+        std::vector<utils::connection> connections;
+        connections.reserve(slot_count);
+
+        for (std::size_t i = 0u; i < slot_count; ++i) {
+            connections.push_back(
+                sig.connect([i](std::size_t value) { sink = sink + value + i; }));
+        }
+
+        sig(1u);
+
+        for (auto& c : connections)
+            c.disconnect();
+
+        sig(2u);
+    });
+}
+
+void print_result(const std::string& name, double reference, double light) {
+    std::cout << std::left << std::setw(32) << name << std::right << std::setw(12)
+              << std::fixed << std::setprecision(1) << reference << std::setw(12) << light
+              << std::setw(10) << std::setprecision(2) << reference / light << "x" << std::endl;
+}
+
+} // namespace
+
+int main() {
+    using reference_signal = utils::signal<void(std::size_t)>;
+    using light_signal     = utils::light_signal<void(std::size_t)>;
+
+    std::cout << std::left << std::setw(32) << "benchmark (ns per iteration)" << std::right
+              << std::setw(12) << "signal" << std::setw(12) << "light" << std::setw(11)
+              << "speedup" << std::endl;
+
+    for (std::size_t slot_count : {0u, 1u, 4u, 16u, 128u}) {
+        const std::size_t iterations = 20000000u / (slot_count + 1u);
+        print_result(
+            "trigger, " + std::to_string(slot_count) + " slots",
+            benchmark_trigger<reference_signal>(slot_count, iterations),
+            benchmark_trigger<light_signal>(slot_count, iterations));
+    }
+
+    for (std::size_t slot_count : {1u, 16u}) {
+        const std::size_t iterations = 2000000u / slot_count;
+        print_result(
+            "connect/disconnect, " + std::to_string(slot_count) + " slots",
+            benchmark_connect<reference_signal>(slot_count, iterations),
+            benchmark_connect<light_signal>(slot_count, iterations));
+    }
+
+    return 0;
+}
@@ -0,0 +1,52 @@
+ListViewTest = {};
+
+function ListViewTest.bind_row(list, row, index)
+    row:set_text("Row "..index);
+end
+
+-- Scrolls through the whole list by steps of a third of a row, and checks that
+-- each visible row is displayed by a frame bound to the right index, and that
+-- the same few row frames are recycled rather than new ones being created.
+function ListViewTest.check(list)
+    local row_height = list:get_row_height();
+    local range = list:get_vertical_scroll_range();
+    local visible_count = math.ceil(list:get_height()/row_height);
+    local max_frame_count = visible_count + 1 + 2*list:get_overscan();
+
+    local frames = {};
+    local frame_count = 0;
+    local error_count = 0;
+    local scroll = 0;
+
+    while true do
+        list:set_vertical_scroll(math.min(scroll, range));
+
+        local first = math.floor(list:get_vertical_scroll()/row_height) + 1;
+        local last = math.min(first + visible_count, list:get_row_count());
+        for i = first, last do
+            local row = list:get_row_frame(i);
+            if not row or list:get_row_index(row) ~= i or row:get_text() ~= "Row "..i then
+                error_count = error_count + 1;
+            elseif not frames[row:get_name()] then
+                frames[row:get_name()] = true;
+                frame_count = frame_count + 1;
+            end
+        end
+
+        if scroll >= range then
+            break;
+        end
+
+        scroll = scroll + row_height/3;
+    end
+
+    list:set_vertical_scroll(0);
+
+    if error_count ~= 0 or frame_count > max_frame_count then
+        log("# Error # : ListViewTest : "..error_count.." rows displayed incorrectly, "
+            ..frame_count.." row frames used (expected at most "..max_frame_count..").");
+    else
+        log("ListViewTest : "..list:get_row_count().." rows displayed with "
+            ..frame_count.." row frames.");
+    end
+end
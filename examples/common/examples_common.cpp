@@ -8,6 +8,7 @@
 #include <lxgui/gui_edit_box.hpp>
 #include <lxgui/gui_factory.hpp>
 #include <lxgui/gui_font_string.hpp>
+#include <lxgui/gui_list_view.hpp>
 #include <lxgui/gui_out.hpp>
 #include <lxgui/gui_renderer.hpp>
 #include <lxgui/gui_root.hpp>
@@ -65,6 +66,7 @@ void examples_setup_gui(gui::manager& manager) {
     factory.register_region_type<gui::slider>();
     factory.register_region_type<gui::edit_box>();
     factory.register_region_type<gui::scroll_frame>();
+    factory.register_region_type<gui::list_view>();
     factory.register_region_type<gui::status_bar>();
 
     // Then we register our own custom Lua functions onto the Lua state.
@@ -108,6 +108,10 @@ atlas_page::add_material_(const gui::material& mat, const bounds2f& location) {
 
     glBindTexture(GL_TEXTURE_2D, previous_id);
 
+    return create_material_(location);
+}
+
+std::shared_ptr<gui::material> atlas_page::create_material_(const bounds2f& location) const {
     return std::make_shared<gl::material>(
         texture_handle_, vector2ui(size_, size_), location, filter_);
 }
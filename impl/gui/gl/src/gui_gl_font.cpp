@@ -13,6 +13,9 @@
 #include FT_OUTLINE_H
 #include FT_STROKER_H
 
+#include <algorithm>
+#include <cmath>
+
 // Convert fixed point to floating point
 template<std::size_t Point, typename T>
 float ft_float(T value) {
@@ -68,8 +71,321 @@ void release_freetype() {
     }
 }
 
+void load_face(FT_Library ft, const std::string& font_file, std::size_t size, FT_Face& face) {
+    if (FT_New_Face(ft, font_file.c_str(), 0, &face) != 0) {
+        throw gui::exception(
+            "gui::gl::font", "Error loading font: \"" + font_file + "\": cannot load face.");
+    }
+
+    if (FT_Select_Charmap(face, FT_ENCODING_UNICODE) != 0) {
+        throw gui::exception(
+            "gui::gl::font",
+            "Error loading font: \"" + font_file + "\": cannot select Unicode character map.");
+    }
+
+    if (FT_Set_Pixel_Sizes(face, 0, size) != 0) {
+        throw gui::exception(
+            "gui::gl::font", "Error loading font: \"" + font_file + "\": cannot set font size.");
+    }
+}
+
+float get_baseline_offset(FT_Face face) {
+    if (FT_IS_SCALABLE(face)) {
+        FT_Fixed scale = face->size->metrics.y_scale;
+        return ft_ceil<6>(FT_MulFix(face->ascender, scale)) +
+               ft_ceil<6>(FT_MulFix(face->descender, scale));
+    } else {
+        return ft_ceil<6>(face->size->metrics.ascender) +
+               ft_ceil<6>(face->size->metrics.descender);
+    }
+}
+
+// Value larger than any squared distance found in a glyph
+constexpr double edt_infinity = 1e20;
+
+// Squared euclidean distance transform of a sampled 1D function, in linear time.
+// See: P. Felzenszwalb & D. Huttenlocher, "Distance Transforms of Sampled Functions" (2012).
+void distance_transform_1d(
+    std::vector<double>&      grid,
+    std::size_t               offset,
+    std::size_t               stride,
+    std::size_t               length,
+    std::vector<double>&      f,
+    std::vector<std::size_t>& v,
+    std::vector<double>&      z) {
+    for (std::size_t q = 0; q < length; ++q)
+        f[q] = grid[offset + q * stride];
+
+    // Intersection of the parabolas rooted at q and p
+    auto intersect = [&](std::size_t q, std::size_t p) {
+        const double dq = static_cast<double>(q);
+        const double dp = static_cast<double>(p);
+        return ((f[q] + dq * dq) - (f[p] + dp * dp)) / (2.0 * (dq - dp));
+    };
+
+    // Compute the lower envelope of all parabolas
+    std::size_t k = 0;
+    v[0]          = 0;
+    z[0]          = -edt_infinity;
+    z[1]          = edt_infinity;
+
+    for (std::size_t q = 1; q < length; ++q) {
+        double s = intersect(q, v[k]);
+        while (s <= z[k]) {
+            --k;
+            s = intersect(q, v[k]);
+        }
+
+        ++k;
+        v[k]     = q;
+        z[k]     = s;
+        z[k + 1] = edt_infinity;
+    }
+
+    // Sample the lower envelope
+    k = 0;
+    for (std::size_t q = 0; q < length; ++q) {
+        while (z[k + 1] < static_cast<double>(q))
+            ++k;
+
+        const double d            = static_cast<double>(q) - static_cast<double>(v[k]);
+        grid[offset + q * stride] = d * d + f[v[k]];
+    }
+}
+
+void distance_transform_2d(std::vector<double>& grid, std::size_t width, std::size_t height) {
+    const std::size_t        length = std::max(width, height);
+    std::vector<double>      f(length);
+    std::vector<std::size_t> v(length);
+    std::vector<double>      z(length + 1);
+
+    for (std::size_t x = 0; x < width; ++x)
+        distance_transform_1d(grid, x, width, height, f, v, z);
+
+    for (std::size_t y = 0; y < height; ++y)
+        distance_transform_1d(grid, y * width, 1, width, f, v, z);
+}
+
+// Converts a glyph coverage bitmap into a signed distance field, with a margin of 'spread'
+// texels on each side. The distance is encoded so that the glyph edge maps to 0.5,
+// texels inside the glyph are above 0.5, and texels outside are below.
+std::vector<std::uint8_t> make_distance_field(const FT_Bitmap& bitmap, std::size_t spread) {
+    const std::size_t width  = bitmap.width + 2 * spread;
+    const std::size_t height = bitmap.rows + 2 * spread;
+
+    // Squared distance to the nearest texel outside and inside the glyph, respectively.
+    // Partially covered texels are assumed to sit at a sub-texel distance from the edge.
+    std::vector<double> outer(width * height, edt_infinity);
+    std::vector<double> inner(width * height, 0.0);
+
+    for (std::size_t j = 0; j < bitmap.rows; ++j) {
+        const unsigned char* row = bitmap.buffer + j * bitmap.pitch;
+        for (std::size_t i = 0; i < bitmap.width; ++i) {
+            const double coverage = row[i] / 255.0;
+            if (coverage == 0.0)
+                continue;
+
+            const std::size_t index = (j + spread) * width + i + spread;
+            if (coverage == 1.0) {
+                outer[index] = 0.0;
+                inner[index] = edt_infinity;
+            } else {
+                outer[index] = std::pow(std::max(0.0, 0.5 - coverage), 2.0);
+                inner[index] = std::pow(std::max(0.0, coverage - 0.5), 2.0);
+            }
+        }
+    }
+
+    distance_transform_2d(outer, width, height);
+    distance_transform_2d(inner, width, height);
+
+    std::vector<std::uint8_t> data(width * height);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        const double distance = std::sqrt(outer[i]) - std::sqrt(inner[i]);
+        const double value    = std::clamp(0.5 - 0.5 * distance / spread, 0.0, 1.0);
+        data[i]               = static_cast<std::uint8_t>(std::round(255.0 * value));
+    }
+
+    return data;
+}
+
 } // namespace
 
+distance_field_face::distance_field_face(
+    const std::string& font_file, const std::vector<code_point_range>& code_points) {
+    if (!utils::file_exists(font_file))
+        throw gui::exception("gui::gl::font", "Cannot find file \"" + font_file + "\".");
+
+    FT_Library ft = get_freetype();
+
+    try {
+        // Add some space between letters to prevent artifacts
+        const std::size_t spacing = 1;
+
+        // Reserve a white area in the top-left corner, for untextured quads
+        const std::size_t white_size = 2;
+
+        load_face(ft, font_file, reference_size, face_);
+
+        if (FT_HAS_KERNING(face_))
+            kerning_ = true;
+
+        const float       y_offset   = get_baseline_offset(face_);
+        const FT_Int32    load_flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_HINTING;
+        const std::size_t margin     = spread;
+
+        struct glyph_image {
+            character_info*           info = nullptr;
+            std::size_t               width = 0, height = 0;
+            std::size_t               x = 0, y = 0;
+            std::vector<std::uint8_t> data;
+        };
+
+        std::vector<glyph_image> image_list;
+        std::size_t              total_area = 0, max_width = 0;
+
+        // Rasterize all glyphs
+        range_list_.reserve(code_points.size());
+        for (const code_point_range& range : code_points) {
+            range_info& info = range_list_.emplace_back();
+            info.range       = range;
+            info.data.resize(range.last - range.first + 1);
+
+            for (char32_t code_point = range.first; code_point <= range.last; ++code_point) {
+                character_info& ci = info.data[code_point - range.first];
+                ci.code_point      = code_point;
+                ci.glyph_index     = FT_Get_Char_Index(face_, code_point);
+
+                if (FT_Load_Char(face_, code_point, load_flags) != 0 ||
+                    FT_Render_Glyph(face_->glyph, FT_RENDER_MODE_NORMAL) != 0) {
+                    gui::out << gui::warning << "gui::gl::font: Cannot load character "
+                             << code_point << " in font \"" << font_file << "\"." << std::endl;
+                    continue;
+                }
+
+                const FT_GlyphSlot slot   = face_->glyph;
+                const FT_Bitmap&   bitmap = slot->bitmap;
+
+                ci.advance = ft_round<6>(slot->advance.x);
+
+                // Some characters do not have a bitmap, like white spaces.
+                // This is legal, and we should just have blank geometry for them.
+                if (bitmap.width == 0 || bitmap.rows == 0 || !bitmap.buffer)
+                    continue;
+
+                glyph_image& image = image_list.emplace_back();
+                image.info         = &ci;
+                image.width        = bitmap.width + 2 * margin;
+                image.height       = bitmap.rows + 2 * margin;
+                image.data         = make_distance_field(bitmap, margin);
+
+                ci.rect.left   = static_cast<float>(slot->bitmap_left) - margin;
+                ci.rect.right  = ci.rect.left + image.width;
+                ci.rect.top    = y_offset - slot->bitmap_top - margin;
+                ci.rect.bottom = ci.rect.top + image.height;
+
+                total_area += (image.width + spacing) * (image.height + spacing);
+                max_width = std::max(max_width, image.width);
+            }
+        }
+
+        // Calculate the size of the texture
+        std::size_t final_width = static_cast<std::size_t>(std::sqrt(float(total_area)));
+        final_width += max_width + white_size + spacing;
+
+        // Round up to nearest power of two
+        {
+            std::size_t i = 1;
+            while (final_width > i)
+                i *= 2;
+            final_width = i;
+        }
+
+        // Place glyphs row by row
+        std::size_t x = white_size + spacing, y = 0, row_height = white_size;
+        for (auto& image : image_list) {
+            if (x + image.width > final_width) {
+                y += row_height + spacing;
+                x          = 0;
+                row_height = 0;
+            }
+
+            image.x = x;
+            image.y = y;
+
+            x += image.width + spacing;
+            row_height = std::max(row_height, image.height);
+        }
+
+        std::size_t final_height = 1;
+        while (final_height < y + row_height)
+            final_height *= 2;
+
+        std::vector<color32> data(final_width * final_height);
+        std::fill(data.begin(), data.end(), color32{255, 255, 255, 0});
+
+        for (std::size_t j = 0; j < white_size; ++j) {
+            for (std::size_t i = 0; i < white_size; ++i)
+                data[j * final_width + i].a = 255;
+        }
+
+        for (const auto& image : image_list) {
+            const std::uint8_t* buffer = image.data.data();
+            for (std::size_t j = 0; j < image.height; ++j) {
+                std::size_t row_offset = (image.y + j) * final_width + image.x;
+                for (std::size_t i = 0; i < image.width; ++i, ++buffer)
+                    data[i + row_offset].a = *buffer;
+            }
+
+            character_info& ci = *image.info;
+            ci.uvs.left        = image.x / float(final_width);
+            ci.uvs.top         = image.y / float(final_height);
+            ci.uvs.right       = (image.x + image.width) / float(final_width);
+            ci.uvs.bottom      = (image.y + image.height) / float(final_height);
+        }
+
+        // Note: no alpha pre-multiplication here, alpha holds the distance
+        texture_ = std::make_shared<gl::material>(
+            vector2ui(final_width, final_height), material::wrap::clamp, material::filter::linear);
+        texture_->update_texture(data.data());
+    } catch (...) {
+        if (face_)
+            FT_Done_Face(face_);
+        release_freetype();
+        throw;
+    }
+}
+
+distance_field_face::~distance_field_face() {
+    if (face_)
+        FT_Done_Face(face_);
+    release_freetype();
+}
+
+const std::vector<distance_field_face::range_info>& distance_field_face::get_range_list() const {
+    return range_list_;
+}
+
+const std::shared_ptr<gl::material>& distance_field_face::get_texture() const {
+    return texture_;
+}
+
+bool distance_field_face::has_kerning() const {
+    return kerning_;
+}
+
+float distance_field_face::get_kerning(FT_UInt glyph1, FT_UInt glyph2) const {
+    if (!kerning_)
+        return 0.0f;
+
+    // FT_Get_Kerning returns zero on success
+    FT_Vector kerning;
+    if (FT_Get_Kerning(face_, glyph1, glyph2, FT_KERNING_UNFITTED, &kerning) != 0)
+        return 0.0f;
+
+    return ft_float<6>(kerning.x);
+}
+
 font::font(
     const std::string&                   font_file,
     std::size_t                          size,
@@ -99,10 +415,7 @@ font::font(
         // Add some space between letters to prevent artifacts
         const std::size_t spacing = 1;
 
-        if (FT_New_Face(ft, font_file.c_str(), 0, &face_) != 0) {
-            throw gui::exception(
-                "gui::gl::font", "Error loading font: \"" + font_file + "\": cannot load face.");
-        }
+        load_face(ft, font_file, size, face_);
 
         if (outline > 0) {
             if (FT_Stroker_New(ft, &stroker) != 0) {
@@ -112,18 +425,6 @@ font::font(
             }
         }
 
-        if (FT_Select_Charmap(face_, FT_ENCODING_UNICODE) != 0) {
-            throw gui::exception(
-                "gui::gl::font",
-                "Error loading font: \"" + font_file + "\": cannot select Unicode character map.");
-        }
-
-        if (FT_Set_Pixel_Sizes(face_, 0, size) != 0) {
-            throw gui::exception(
-                "gui::gl::font",
-                "Error loading font: \"" + font_file + "\": cannot set font size.");
-        }
-
         FT_Int32 load_flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_HINTING;
         if (outline != 0)
             load_flags |= FT_LOAD_NO_BITMAP;
@@ -197,15 +498,7 @@ font::font(
         if (FT_HAS_KERNING(face_))
             kerning_ = true;
 
-        float y_offset = 0.0f;
-        if (FT_IS_SCALABLE(face_)) {
-            FT_Fixed scale = face_->size->metrics.y_scale;
-            y_offset       = ft_ceil<6>(FT_MulFix(face_->ascender, scale)) +
-                       ft_ceil<6>(FT_MulFix(face_->descender, scale));
-        } else {
-            y_offset = ft_ceil<6>(face_->size->metrics.ascender) +
-                       ft_ceil<6>(face_->size->metrics.descender);
-        }
+        const float y_offset = get_baseline_offset(face_);
 
         for (const code_point_range& range : code_points) {
             range_info info;
@@ -215,6 +508,7 @@ font::font(
             for (char32_t code_point = range.first; code_point <= range.last; ++code_point) {
                 character_info& ci = info.data[code_point - range.first];
                 ci.code_point      = code_point;
+                ci.glyph_index     = FT_Get_Char_Index(face_, code_point);
 
                 if (FT_Load_Char(face_, code_point, load_flags) != 0) {
                     gui::out << gui::warning << "gui::gl::font: Cannot load character "
@@ -282,6 +576,8 @@ font::font(
 
         FT_Stroker_Done(stroker);
 
+        build_character_map_();
+
         gl::material::premultiply_alpha(data);
 
         texture_ = std::make_shared<gl::material>(vector2ui(final_width, final_height));
@@ -298,10 +594,64 @@ font::font(
     }
 }
 
+font::font(
+    std::shared_ptr<const distance_field_face> face,
+    std::size_t                                size,
+    std::size_t                                outline,
+    char32_t                                   default_code_point) :
+    size_(size),
+    default_code_point_(default_code_point),
+    range_list_(face->get_range_list()),
+    distance_field_(std::move(face)) {
+    // Scale metrics from the reference size
+    distance_field_scale_ =
+        static_cast<float>(size_) / static_cast<float>(distance_field_face::reference_size);
+
+    for (auto& info : range_list_) {
+        for (auto& ci : info.data) {
+            ci.rect    = ci.rect * distance_field_scale_;
+            ci.advance = ci.advance * distance_field_scale_;
+        }
+    }
+
+    kerning_ = distance_field_->has_kerning();
+
+    build_character_map_();
+
+    // Share the texture of the face, and draw the outline by moving the edge threshold
+    const auto& face_texture = distance_field_->get_texture();
+    texture_                 = std::make_shared<gl::material>(
+        face_texture->get_handle(), face_texture->get_canvas_dimensions(),
+        face_texture->get_rect(), face_texture->get_filter());
+
+    // Keep at least one texel of distance field for anti-aliasing
+    const float spread           = static_cast<float>(distance_field_face::spread);
+    const float max_distance     = spread - 1.0f;
+    float       outline_distance = static_cast<float>(outline) / distance_field_scale_;
+    if (outline_distance > max_distance) {
+        gui::out << gui::warning << "gui::gl::font: Outline of " << outline
+                 << " is too thick for a distance field font of size " << size_
+                 << "; it will be drawn thinner." << std::endl;
+        outline_distance = max_distance;
+    }
+
+    texture_->set_distance_field(0.5f - 0.5f * outline_distance / spread);
+}
+
 font::~font() {
     if (face_)
         FT_Done_Face(face_);
-    release_freetype();
+    if (!distance_field_)
+        release_freetype();
+}
+
+void font::build_character_map_() {
+    for (const auto& info : range_list_) {
+        for (const auto& ci : info.data)
+            character_map_.set(ci.code_point, &ci);
+    }
+
+    default_character_ = character_map_.get(default_code_point_);
 }
 
 std::size_t font::get_size() const {
@@ -309,17 +659,10 @@ std::size_t font::get_size() const {
 }
 
 const font::character_info* font::get_character_(char32_t c) const {
-    for (const auto& info : range_list_) {
-        if (c < info.range.first || c > info.range.last)
-            continue;
+    if (const character_info* info = character_map_.get(c))
+        return info;
 
-        return &info.data[c - info.range.first];
-    }
-
-    if (c != default_code_point_)
-        return get_character_(default_code_point_);
-    else
-        return nullptr;
+    return default_character_;
 }
 
 bounds2f font::get_character_uvs(char32_t c) const {
@@ -353,20 +696,60 @@ float font::get_character_height(char32_t c) const {
     if (!info)
         return 0.0f;
 
+    if (distance_field_) {
+        // Remove the margin around the glyph
+        const float margin = distance_field_face::spread * distance_field_scale_;
+        return std::max(0.0f, info->rect.height() - 2.0f * margin);
+    }
+
     return info->rect.height();
 }
 
+void font::get_character_metrics(
+    const char32_t* characters, std::size_t count, character_metrics* output) const {
+    for (std::size_t i = 0; i < count; ++i) {
+        const character_info* info = get_character_(characters[i]);
+        if (!info) {
+            output[i] = character_metrics{};
+            continue;
+        }
+
+        vector2f top_left     = texture_->get_canvas_uv(info->uvs.top_left(), true);
+        vector2f bottom_right = texture_->get_canvas_uv(info->uvs.bottom_right(), true);
+
+        output[i].uvs     = bounds2f(top_left.x, bottom_right.x, top_left.y, bottom_right.y);
+        output[i].bounds  = info->rect;
+        output[i].advance = info->advance;
+    }
+}
+
 float font::get_character_kerning(char32_t c1, char32_t c2) const {
-    if (kerning_) {
-        FT_Vector kerning;
-        FT_UInt   prev = FT_Get_Char_Index(face_, c1);
-        FT_UInt   next = FT_Get_Char_Index(face_, c2);
-        if (FT_Get_Kerning(face_, prev, next, FT_KERNING_UNFITTED, &kerning) != 0)
-            return ft_round<6>(kerning.x);
-        else
-            return 0.0f;
-    } else
+    if (!kerning_)
         return 0.0f;
+
+    const std::uint64_t key = (static_cast<std::uint64_t>(c1) << 32) | c2;
+    auto                iter = kerning_cache_.find(key);
+    if (iter != kerning_cache_.end())
+        return iter->second;
+
+    const character_info* prev = get_character_(c1);
+    const character_info* next = get_character_(c2);
+
+    float value = 0.0f;
+    if (prev && next && distance_field_) {
+        value = distance_field_->get_kerning(prev->glyph_index, next->glyph_index) *
+                distance_field_scale_;
+    } else if (prev && next) {
+        // FT_Get_Kerning returns zero on success
+        FT_Vector kerning;
+        FT_Error  error = FT_Get_Kerning(
+            face_, prev->glyph_index, next->glyph_index, FT_KERNING_UNFITTED, &kerning);
+        if (error == 0)
+            value = ft_round<6>(kerning.x);
+    }
+
+    kerning_cache_.emplace(key, value);
+    return value;
 }
 
 std::weak_ptr<gui::material> font::get_texture() const {
@@ -377,4 +760,8 @@ void font::update_texture(std::shared_ptr<gui::material> mat) {
     texture_ = std::static_pointer_cast<gl::material>(mat);
 }
 
+bool font::is_atlas_compatible() const {
+    return distance_field_ == nullptr;
+}
+
 } // namespace lxgui::gui::gl
@@ -27,7 +27,11 @@
 #if !defined(GL_CLAMP_TO_EDGE)
 #    define GL_CLAMP_TO_EDGE 0x812F
 #endif
+#if !defined(GL_TEXTURE_MAX_LEVEL)
+#    define GL_TEXTURE_MAX_LEVEL 0x813D
+#endif
 
+#include <algorithm>
 #include <cmath>
 
 namespace lxgui::gui::gl {
@@ -147,7 +151,9 @@ void material::set_filter(filter filt) {
     switch (filt) {
     case filter::linear:
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(
+            GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+            num_mipmaps_ > 0u ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
         break;
     case filter::none:
     default:
@@ -156,6 +162,8 @@ void material::set_filter(filter filt) {
         break;
     }
 
+    filter_ = filt;
+
     glBindTexture(GL_TEXTURE_2D, previous_id);
 }
 
@@ -163,6 +171,19 @@ material::filter material::get_filter() const {
     return filter_;
 }
 
+void material::set_distance_field(float threshold) {
+    is_distance_field_        = true;
+    distance_field_threshold_ = threshold;
+}
+
+bool material::is_distance_field() const {
+    return is_distance_field_;
+}
+
+float material::get_distance_field_threshold() const {
+    return distance_field_threshold_;
+}
+
 void material::bind() const {
     glBindTexture(GL_TEXTURE_2D, texture_handle_);
 }
@@ -185,7 +206,12 @@ vector2ui material::get_canvas_dimensions() const {
 }
 
 bool material::uses_same_texture(const gui::material& other) const {
-    return texture_handle_ == static_cast<const gl::material&>(other).texture_handle_;
+    const gl::material& gl_other = static_cast<const gl::material&>(other);
+
+    // Distance field materials need specific shader parameters
+    return texture_handle_ == gl_other.texture_handle_ &&
+           is_distance_field_ == gl_other.is_distance_field_ &&
+           distance_field_threshold_ == gl_other.distance_field_threshold_;
 }
 
 bool material::set_dimensions(const vector2ui& dimensions) {
@@ -240,6 +266,7 @@ bool material::set_dimensions(const vector2ui& dimensions) {
 
         canvas_dimensions_ = canvas_dimensions;
         canvas_updated     = true;
+        num_mipmaps_       = 0u;
     }
 
     rect_ = bounds2f(0, dimensions.x, 0, dimensions.y);
@@ -258,6 +285,36 @@ void material::update_texture(const color32* data) {
     glBindTexture(GL_TEXTURE_2D, previous_id);
 }
 
+void material::update_mipmap(std::size_t level, const color32* data) {
+    if (!is_owner_) {
+        throw gui::exception("gui::gl::material", "A material in an atlas cannot have mipmaps.");
+    }
+
+    if (level == 0u || level > num_mipmaps_ + 1u) {
+        throw gui::exception(
+            "gui::gl::material", "Mipmap levels must be updated in order (got level " +
+                                     utils::to_string(level) + ").");
+    }
+
+    const std::size_t width  = std::max<std::size_t>(canvas_dimensions_.x >> level, 1u);
+    const std::size_t height = std::max<std::size_t>(canvas_dimensions_.y >> level, 1u);
+
+    GLint previous_id;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous_id);
+
+    glBindTexture(GL_TEXTURE_2D, texture_handle_);
+    glTexImage2D(
+        GL_TEXTURE_2D, level, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+
+    // Levels beyond this one are not defined yet; keep the texture complete
+    num_mipmaps_ = level;
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level);
+    if (filter_ == filter::linear)
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+
+    glBindTexture(GL_TEXTURE_2D, previous_id);
+}
+
 std::uint32_t material::get_handle() const {
     return texture_handle_;
 }
@@ -3,6 +3,7 @@
 #include "lxgui/gui_exception.hpp"
 #include "lxgui/gui_out.hpp"
 #include "lxgui/gui_quad.hpp"
+#include "lxgui/gui_texture_file.hpp"
 #include "lxgui/impl/gui_gl_atlas.hpp"
 #include "lxgui/impl/gui_gl_font.hpp"
 #include "lxgui/impl/gui_gl_material.hpp"
@@ -30,6 +31,9 @@
 #    endif
 #endif
 
+#include <algorithm>
+#include <cmath>
+
 namespace lxgui::gui::gl {
 
 #if defined(LXGUI_OPENGL3)
@@ -87,6 +91,7 @@ void renderer::begin_(std::shared_ptr<gui::render_target> target) {
     }
 
     glDisable(GL_DEPTH_TEST);
+    glDisable(GL_SCISSOR_TEST);
     glEnable(GL_BLEND);
     glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); // Premultipled alpha
     glDisable(GL_CULL_FACE);
@@ -104,6 +109,11 @@ void renderer::begin_(std::shared_ptr<gui::render_target> target) {
 }
 
 void renderer::end_() {
+#if defined(LXGUI_OPENGL3)
+    if (stream_buffer_)
+        stream_buffer_->fence();
+#endif
+
     if (current_target_) {
         current_target_->end();
         current_target_ = nullptr;
@@ -134,6 +144,40 @@ matrix4f renderer::get_view() const {
     return current_view_matrix_;
 }
 
+bool renderer::is_scissor_supported() const {
+    return true;
+}
+
+void renderer::set_scissor_(const bounds2f* rect) {
+    if (!rect) {
+        glDisable(GL_SCISSOR_TEST);
+        return;
+    }
+
+    const vector2f viewport = current_target_
+                                  ? vector2f(current_target_->get_canvas_dimensions())
+                                  : vector2f(window_dimensions_);
+
+    // Convert from screen-space to pixels, with the origin at the bottom-left corner
+    float top    = (rect->top + 1.0f) / 2.0f * viewport.y;
+    float bottom = (rect->bottom + 1.0f) / 2.0f * viewport.y;
+    if (!current_target_) {
+        // Rendering to main screen, flip Y
+        top    = viewport.y - top;
+        bottom = viewport.y - bottom;
+    }
+
+    const float left  = std::floor((rect->left + 1.0f) / 2.0f * viewport.x);
+    const float right = std::ceil((rect->right + 1.0f) / 2.0f * viewport.x);
+    const float y_min = std::floor(std::min(top, bottom));
+    const float y_max = std::ceil(std::max(top, bottom));
+
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(
+        static_cast<GLint>(left), static_cast<GLint>(y_min), static_cast<GLsizei>(right - left),
+        static_cast<GLsizei>(y_max - y_min));
+}
+
 void renderer::render_quads_(
     const gui::material* mat, const std::vector<std::array<vertex, 4>>& quad_list) {
 
@@ -171,6 +215,22 @@ void renderer::render_quads_(
         glEnd();
     }
 #else
+    static thread_local std::vector<quad_instance> instance_data;
+
+    const std::size_t num_vertex = quad_list.size() * 4;
+    if (quad_streaming_enabled_ && num_vertex <= stream_buffer_->get_capacity()) {
+        if (instanced_quads_enabled_ &&
+            make_quad_instances(quad_list[0].data(), num_vertex, instance_data)) {
+            setup_uniforms_(mat, matrix4f::identity, true);
+            stream_buffer_->render_quad_instances(instance_data.data(), instance_data.size());
+        } else {
+            setup_uniforms_(mat, matrix4f::identity, false);
+            stream_buffer_->render_quads(quad_list[0].data(), num_vertex);
+        }
+
+        return;
+    }
+
     // Note: we rotate through a fairly large number of vertex caches
     // rather than constantly reusing the same cache. This is because
     // update_data() calls glBufferSubData(), which will wait for the
@@ -181,13 +241,117 @@ void renderer::render_quads_(
     array_cycle_cache_ = (array_cycle_cache_ + 1) % cache_cycle_size;
 
     // Update vertex data
-    cache->update(quad_list[0].data(), quad_list.size() * 4);
+    cache->update(quad_list[0].data(), num_vertex);
 
     // Render
     render_cache_(mat, *cache, matrix4f::identity);
 #endif
 }
 
+void renderer::render_tiled_quads_(
+    const gui::material*                      mat [[maybe_unused]],
+    const std::vector<std::array<vertex, 4>>& quad_list [[maybe_unused]],
+    const std::vector<bounds2f>&              tile_rect_list [[maybe_unused]]) {
+#if !defined(LXGUI_OPENGL3)
+    gui::renderer::render_tiled_quads_(mat, quad_list, tile_rect_list);
+#else
+    static thread_local std::vector<bounds2f> tile_data;
+
+    setup_uniforms_(mat, matrix4f::identity, false);
+
+    // Render in chunks that fit in the stream buffer, with the tiling region of each vertex
+    const std::size_t max_quads = stream_buffer_->get_capacity() * sizeof(vertex) /
+                                  (4u * (sizeof(vertex) + sizeof(bounds2f)));
+
+    for (std::size_t first = 0u; first < quad_list.size(); first += max_quads) {
+        const std::size_t num_quads = std::min(max_quads, quad_list.size() - first);
+
+        tile_data.resize(num_quads * 4u);
+        for (std::size_t i = 0; i < num_quads; ++i) {
+            const bounds2f& rect = tile_rect_list[first + i];
+            std::fill(tile_data.begin() + i * 4, tile_data.begin() + i * 4 + 4, rect);
+        }
+
+        stream_buffer_->render_tiled_quads(
+            quad_list[first].data(), tile_data.data(), num_quads * 4u);
+    }
+#endif
+}
+
+void renderer::render_quads_multi_texture_(
+    const std::vector<const gui::material*>&  material_list,
+    const std::vector<std::array<vertex, 4>>& quad_list,
+    const std::vector<std::size_t>&           slot_list,
+    const std::vector<bounds2f>&              tile_rect_list) {
+#if defined(LXGUI_OPENGL3)
+    static thread_local std::vector<float>    slot_data;
+    static thread_local std::vector<bounds2f> tile_data;
+
+    // Tiled quads cannot use vertex caches, so they are streamed even if streaming is disabled
+    const bool        tiled       = !tile_rect_list.empty();
+    const std::size_t tile_size   = tiled ? sizeof(bounds2f) : 0u;
+    const std::size_t vertex_size = sizeof(vertex) + sizeof(float) + tile_size;
+    const std::size_t num_vertex  = quad_list.size() * 4;
+    const std::size_t num_bytes   = num_vertex * vertex_size;
+    if ((quad_streaming_enabled_ || tiled) && material_list.size() <= texture_slot_count &&
+        num_bytes <= stream_buffer_->get_capacity() * sizeof(vertex)) {
+        // Bind each material to its own texture unit, and setup per-slot uniforms
+        std::array<GLint, texture_slot_count> type_list{};
+        std::array<float, texture_slot_count> threshold_list{};
+        for (std::size_t i = 0; i < material_list.size(); ++i) {
+            const gl::material* gl_mat = static_cast<const gl::material*>(material_list[i]);
+            if (!gl_mat) {
+                type_list[i] = 1;
+                continue;
+            }
+
+            if (gl_mat->is_distance_field()) {
+                type_list[i]      = 2;
+                threshold_list[i] = gl_mat->get_distance_field_threshold();
+            }
+
+            glActiveTexture(GL_TEXTURE0 + static_cast<GLenum>(i));
+            gl_mat->bind();
+
+            if (i == 0)
+                previous_texture_ = gl_mat->get_handle();
+        }
+
+        glActiveTexture(GL_TEXTURE0);
+
+        glUniform1i(shader_cache_->type_location, 3);
+        glUniform1i(shader_cache_->instanced_location, 0);
+        glUniform1iv(shader_cache_->slot_type_location, texture_slot_count, type_list.data());
+        glUniform1fv(
+            shader_cache_->slot_threshold_location, texture_slot_count, threshold_list.data());
+        glUniformMatrix4fv(
+            shader_cache_->model_location, 1, GL_FALSE, matrix4f::identity.data);
+
+        slot_data.resize(num_vertex);
+        for (std::size_t i = 0; i < quad_list.size(); ++i) {
+            const float slot = static_cast<float>(slot_list[i]);
+            std::fill(slot_data.begin() + i * 4, slot_data.begin() + i * 4 + 4, slot);
+        }
+
+        if (tiled) {
+            tile_data.resize(num_vertex);
+            for (std::size_t i = 0; i < quad_list.size(); ++i) {
+                const bounds2f& rect = tile_rect_list[i];
+                std::fill(tile_data.begin() + i * 4, tile_data.begin() + i * 4 + 4, rect);
+            }
+        }
+
+        stream_buffer_->render_multi_texture_quads(
+            quad_list[0].data(), slot_data.data(), tiled ? tile_data.data() : nullptr,
+            num_vertex);
+        return;
+    }
+#endif
+
+    gui::renderer::render_quads_multi_texture_(
+        material_list, quad_list, slot_list, tile_rect_list);
+}
+
 void renderer::render_cache_(
     const gui::material*     mat [[maybe_unused]],
     const gui::vertex_cache& cache [[maybe_unused]],
@@ -195,10 +359,20 @@ void renderer::render_cache_(
 #if !defined(LXGUI_OPENGL3)
     throw gui::exception("gl::renderer", "Legacy OpenGL does not support vertex caches.");
 #else
-    const gl::material*     gl_mat   = static_cast<const gl::material*>(mat);
     const gl::vertex_cache& gl_cache = static_cast<const gl::vertex_cache&>(cache);
 
-    // Setup uniforms
+    setup_uniforms_(mat, model_transform, gl_cache.is_instanced());
+
+    // Render
+    gl_cache.render();
+#endif
+}
+
+#if defined(LXGUI_OPENGL3)
+void renderer::setup_uniforms_(
+    const gui::material* mat, const matrix4f& model_transform, bool instanced) {
+    const gl::material* gl_mat = static_cast<const gl::material*>(mat);
+
     int type = 0;
     if (gl_mat) {
         type = 0;
@@ -206,17 +380,20 @@ void renderer::render_cache_(
             gl_mat->bind();
             previous_texture_ = gl_mat->get_handle();
         }
+
+        if (gl_mat->is_distance_field()) {
+            type = 2;
+            glUniform1f(shader_cache_->threshold_location, gl_mat->get_distance_field_threshold());
+        }
     } else {
         type = 1;
     }
 
     glUniform1i(shader_cache_->type_location, type);
+    glUniform1i(shader_cache_->instanced_location, instanced ? 1 : 0);
     glUniformMatrix4fv(shader_cache_->model_location, 1, GL_FALSE, model_transform.data);
-
-    // Render
-    gl_cache.render();
-#endif
 }
+#endif
 
 std::shared_ptr<gui::material>
 renderer::create_material_(const std::string& file_name, material::filter filt) {
@@ -227,6 +404,22 @@ renderer::create_material_(const std::string& file_name, material::filter filt)
     return create_material_png_(file_name, filt);
 }
 
+std::shared_ptr<gui::material>
+renderer::create_material_texture_file_(const texture_file& file, material::filter filt) {
+    std::shared_ptr<gl::material> tex =
+        std::make_shared<gl::material>(file.get_dimensions(), material::wrap::repeat, filt);
+
+    tex->update_texture(file.get_level_data(0));
+
+    // Mipmaps can only be used if the texture fills its canvas
+    if (tex->get_canvas_dimensions() == file.get_dimensions()) {
+        for (std::size_t level = 1u; level < file.get_num_levels(); ++level)
+            tex->update_mipmap(level, file.get_level_data(level));
+    }
+
+    return std::move(tex);
+}
+
 std::shared_ptr<gui::atlas> renderer::create_atlas_(material::filter filt) {
     return std::make_shared<gl::atlas>(*this, filt);
 }
@@ -267,7 +460,28 @@ std::shared_ptr<gui::font> renderer::create_font_(
     std::size_t                          outline,
     const std::vector<code_point_range>& code_points,
     char32_t                             default_code_point) {
-    return std::make_shared<gl::font>(font_file, size, outline, code_points, default_code_point);
+    if (!distance_field_font_enabled_) {
+        return std::make_shared<gl::font>(
+            font_file, size, outline, code_points, default_code_point);
+    }
+
+    // Distance field faces are shared by all sizes and outlines
+    std::string face_name = font_file;
+    for (const code_point_range& range : code_points)
+        face_name += "|c" + utils::to_string(range.first) + "-" + utils::to_string(range.last);
+
+    std::shared_ptr<const gl::distance_field_face> face;
+
+    auto iter = distance_field_face_list_.find(face_name);
+    if (iter != distance_field_face_list_.end())
+        face = iter->second.lock();
+
+    if (!face) {
+        face = std::make_shared<gl::distance_field_face>(font_file, code_points);
+        distance_field_face_list_[face_name] = face;
+    }
+
+    return std::make_shared<gl::font>(std::move(face), size, outline, default_code_point);
 }
 
 bool renderer::is_texture_atlas_supported() const {
@@ -278,6 +492,18 @@ bool renderer::is_texture_vertex_color_supported() const {
     return true;
 }
 
+bool renderer::is_texture_file_supported() const {
+    return true;
+}
+
+bool renderer::is_quad_tiling_supported() const {
+#if !defined(LXGUI_OPENGL3)
+    return false;
+#else
+    return true;
+#endif
+}
+
 bool renderer::is_vertex_cache_supported() const {
 #if !defined(LXGUI_OPENGL3)
     return false;
@@ -291,7 +517,10 @@ std::shared_ptr<gui::vertex_cache> renderer::create_vertex_cache(gui::vertex_cac
 #if !defined(LXGUI_OPENGL3)
     throw gui::exception("gl::renderer", "Legacy OpenGL does not support vertex caches.");
 #else
-    return std::make_shared<gl::vertex_cache>(type);
+    auto cache = std::make_shared<gl::vertex_cache>(type);
+    cache->set_packed_vertex_enabled(packed_vertex_enabled_);
+    cache->set_instanced_quads_enabled(instanced_quads_enabled_);
+    return cache;
 #endif
 }
 
@@ -299,6 +528,102 @@ void renderer::notify_window_resized(const vector2ui& new_dimensions) {
     window_dimensions_ = new_dimensions;
 }
 
+void renderer::set_distance_field_font_enabled(bool enabled) {
+#if !defined(LXGUI_OPENGL3)
+    if (enabled) {
+        gui::out << gui::warning
+                 << "gui::gl::renderer: Distance field fonts are not supported with legacy OpenGL."
+                 << std::endl;
+        return;
+    }
+#endif
+
+    distance_field_font_enabled_ = enabled;
+}
+
+std::size_t renderer::get_batch_texture_slot_count() const {
+#if !defined(LXGUI_OPENGL3)
+    return 1u;
+#else
+    return texture_slot_count;
+#endif
+}
+
+bool renderer::is_quad_streaming_enabled() const {
+#if !defined(LXGUI_OPENGL3)
+    return false;
+#else
+    return quad_streaming_enabled_;
+#endif
+}
+
+void renderer::set_quad_streaming_enabled(bool enabled) {
+#if !defined(LXGUI_OPENGL3)
+    if (enabled) {
+        gui::out << gui::warning
+                 << "gui::gl::renderer: Quad streaming is not supported with legacy OpenGL."
+                 << std::endl;
+    }
+#else
+    quad_streaming_enabled_ = enabled;
+#endif
+}
+
+bool renderer::is_distance_field_font_enabled() const {
+    return distance_field_font_enabled_;
+}
+
+void renderer::set_packed_vertex_enabled(bool enabled) {
+#if !defined(LXGUI_OPENGL3)
+    if (enabled) {
+        gui::out << gui::warning
+                 << "gui::gl::renderer: Packed vertices are not supported with legacy OpenGL."
+                 << std::endl;
+        return;
+    }
+#else
+    for (auto* cache_list : {&quad_cache_, &array_cache_}) {
+        for (const auto& cache : *cache_list) {
+            if (cache)
+                cache->set_packed_vertex_enabled(enabled);
+        }
+    }
+
+    if (stream_buffer_)
+        stream_buffer_->set_packed_vertex_enabled(enabled);
+#endif
+
+    packed_vertex_enabled_ = enabled;
+}
+
+bool renderer::is_packed_vertex_enabled() const {
+    return packed_vertex_enabled_;
+}
+
+void renderer::set_instanced_quads_enabled(bool enabled) {
+#if !defined(LXGUI_OPENGL3)
+    if (enabled) {
+        gui::out << gui::warning
+                 << "gui::gl::renderer: Instanced quads are not supported with legacy OpenGL."
+                 << std::endl;
+        return;
+    }
+#else
+    for (auto* cache_list : {&quad_cache_, &array_cache_}) {
+        for (const auto& cache : *cache_list) {
+            if (cache)
+                cache->set_instanced_quads_enabled(enabled);
+        }
+    }
+#endif
+
+    instanced_quads_enabled_ = enabled;
+}
+
+bool renderer::is_instanced_quads_enabled() const {
+    return instanced_quads_enabled_;
+}
+
 #if !defined(LXGUI_OPENGL3)
 bool renderer::is_gl_extension_supported(const std::string& extension) {
     // Extension names should not have spaces
@@ -412,31 +737,93 @@ void renderer::compile_programs_() {
                                "layout(location = 0) in vec2 a_position;                  \n"
                                "layout(location = 1) in vec4 a_color;                     \n"
                                "layout(location = 2) in vec2 a_texCoord;                  \n"
+                               "layout(location = 3) in vec4 a_rect;                      \n"
+                               "layout(location = 4) in vec4 a_texRect;                   \n"
+                               "layout(location = 5) in vec4 a_color0;                    \n"
+                               "layout(location = 6) in vec4 a_color1;                    \n"
+                               "layout(location = 7) in vec4 a_color2;                    \n"
+                               "layout(location = 8) in vec4 a_color3;                    \n"
+                               "layout(location = 9) in float a_texSlot;                  \n"
+                               "layout(location = 10) in vec4 a_tileRect;                 \n"
                                "uniform mat4 m_proj;                                      \n"
                                "uniform mat4 m_model;                                     \n"
+                               "uniform int i_instanced;                                  \n"
                                "out vec4 v_color;                                         \n"
                                "out vec2 v_texCoord;                                      \n"
+                               "flat out mediump int v_texSlot;                           \n"
+                               "flat out vec4 v_tileRect;                                 \n"
                                "void main()                                               \n"
                                "{                                                         \n"
-                               "    gl_Position = m_proj*m_model*vec4(a_position.xy,0,1); \n"
+                               "    vec2 position = a_position;                           \n"
+                               "    v_texSlot = int(a_texSlot);                           \n"
                                "    v_color = a_color;                                    \n"
-                               "    v_color.rgb *= v_color.a;                             \n"
                                "    v_texCoord = a_texCoord;                              \n"
+                               "    v_tileRect = a_tileRect;                              \n"
+                               "    if (i_instanced != 0)                                 \n"
+                               "    {                                                     \n"
+                               "        int i = gl_VertexID;                              \n"
+                               "        int c = i == 5 ? 0 : (i > 2 ? i - 1 : i);         \n"
+                               "        vec2 t = vec2(c == 1 || c == 2, c == 2 || c == 3);\n"
+                               "        position = mix(a_rect.xy, a_rect.zw, t);          \n"
+                               "        v_texCoord = mix(a_texRect.xy, a_texRect.zw, t);  \n"
+                               "        v_color = c == 0 ? a_color0 : c == 1 ? a_color1 : \n"
+                               "                  c == 2 ? a_color2 : a_color3;           \n"
+                               "    }                                                     \n"
+                               "    gl_Position = m_proj*m_model*vec4(position.xy,0,1);   \n"
+                               "    v_color.rgb *= v_color.a;                             \n"
                                "}                                                         \n";
 
         char fragment_shader[] = "#version 300 es                                           \n"
                                  "precision mediump float;                                  \n"
                                  "in vec4 v_color;                                          \n"
-                                 "in vec2 v_texCoord;                                       \n"
+                                 "in highp vec2 v_texCoord;                                 \n"
+                                 "flat in mediump int v_texSlot;                            \n"
+                                 "flat in highp vec4 v_tileRect;                            \n"
                                  "layout(location = 0) out vec4 o_color;                    \n"
                                  "uniform mediump int i_type;                               \n"
-                                 "uniform sampler2D s_texture;                              \n"
+                                 "uniform sampler2D s_texture[8];                           \n"
+                                 "uniform float f_threshold;                                \n"
+                                 "uniform mediump int i_slotType[8];                        \n"
+                                 "uniform float f_slotThreshold[8];                         \n"
+                                 "vec4 sample_slot(int s, vec2 uv)                          \n"
+                                 "{                                                         \n"
+                                 "    if (s == 1) return texture(s_texture[1], uv);         \n"
+                                 "    if (s == 2) return texture(s_texture[2], uv);         \n"
+                                 "    if (s == 3) return texture(s_texture[3], uv);         \n"
+                                 "    if (s == 4) return texture(s_texture[4], uv);         \n"
+                                 "    if (s == 5) return texture(s_texture[5], uv);         \n"
+                                 "    if (s == 6) return texture(s_texture[6], uv);         \n"
+                                 "    if (s == 7) return texture(s_texture[7], uv);         \n"
+                                 "    return texture(s_texture[0], uv);                     \n"
+                                 "}                                                         \n"
                                  "void main()                                               \n"
                                  "{                                                         \n"
-                                 "    if (i_type == 0)                                      \n"
-                                 "        o_color = texture(s_texture, v_texCoord)*v_color; \n"
-                                 "    else                                                  \n"
+                                 "    int type = i_type;                                    \n"
+                                 "    int slot = 0;                                         \n"
+                                 "    float threshold = f_threshold;                        \n"
+                                 "    highp vec2 uv = v_texCoord;                           \n"
+                                 "    if (v_tileRect.y > v_tileRect.x)                      \n"
+                                 "    {                                                     \n"
+                                 "        highp vec2 size = v_tileRect.yw - v_tileRect.xz;  \n"
+                                 "        uv = v_tileRect.xz + fract(uv)*size;              \n"
+                                 "    }                                                     \n"
+                                 "    if (type == 3)                                        \n"
+                                 "    {                                                     \n"
+                                 "        slot = v_texSlot;                                 \n"
+                                 "        type = i_slotType[slot];                          \n"
+                                 "        threshold = f_slotThreshold[slot];                \n"
+                                 "    }                                                     \n"
+                                 "    if (type == 0)                                        \n"
+                                 "        o_color = sample_slot(slot, uv)*v_color;          \n"
+                                 "    else if (type == 1)                                   \n"
                                  "        o_color = v_color;                                \n"
+                                 "    else                                                  \n"
+                                 "    {                                                     \n"
+                                 "        float d = sample_slot(slot, uv).a;                \n"
+                                 "        float w = max(fwidth(d), 0.0001);                 \n"
+                                 "        float a = clamp((d-threshold)/w+0.5, 0.0, 1.0);   \n"
+                                 "        o_color = v_color*a;                              \n"
+                                 "    }                                                     \n"
                                  "}                                                         \n";
 
         shader_cache_ = std::make_shared<shader_cache>();
@@ -452,6 +839,23 @@ void renderer::compile_programs_() {
         shader_cache_->proj_location    = glGetUniformLocation(shader_cache_->program, "m_proj");
         shader_cache_->model_location   = glGetUniformLocation(shader_cache_->program, "m_model");
         shader_cache_->type_location    = glGetUniformLocation(shader_cache_->program, "i_type");
+        shader_cache_->threshold_location =
+            glGetUniformLocation(shader_cache_->program, "f_threshold");
+        shader_cache_->instanced_location =
+            glGetUniformLocation(shader_cache_->program, "i_instanced");
+        shader_cache_->slot_type_location =
+            glGetUniformLocation(shader_cache_->program, "i_slotType");
+        shader_cache_->slot_threshold_location =
+            glGetUniformLocation(shader_cache_->program, "f_slotThreshold");
+
+        // Each texture slot samples from the texture unit of the same index
+        std::array<GLint, texture_slot_count> texture_units;
+        for (std::size_t i = 0; i < texture_slot_count; ++i)
+            texture_units[i] = static_cast<GLint>(i);
+
+        glUseProgram(shader_cache_->program);
+        glUniform1iv(shader_cache_->sampler_location, texture_slot_count, texture_units.data());
+        glUseProgram(0);
 
         static_shader_cache = shader_cache_;
         shader_cached       = true;
@@ -478,6 +882,9 @@ void renderer::setup_buffers_() {
             create_vertex_cache(vertex_cache::type::quads));
         array_cache_[i]->update_indices(repeated_ids.data(), repeated_ids.size());
     }
+
+    stream_buffer_ = std::make_unique<gl::stream_buffer>(stream_buffer_capacity);
+    stream_buffer_->set_packed_vertex_enabled(packed_vertex_enabled_);
 }
 #endif
 
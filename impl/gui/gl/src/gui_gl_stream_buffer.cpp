@@ -0,0 +1,346 @@
+#include "lxgui/impl/gui_gl_stream_buffer.hpp"
+
+#include "lxgui/gui_exception.hpp"
+#include "lxgui/utils_string.hpp"
+
+#if defined(LXGUI_PLATFORM_WINDOWS)
+#    define NOMINMAX
+#    include <windows.h>
+#endif
+
+#if !defined(LXGUI_COMPILER_EMSCRIPTEN)
+#    include <GL/glew.h>
+#    if defined(LXGUI_PLATFORM_OSX)
+#        include <OpenGL/gl.h>
+#    else
+#        include <GL/gl.h>
+#    endif
+#else
+#    if defined(LXGUI_PLATFORM_OSX)
+#        include <OpenGLES/ES3/gl.h>
+#    else
+#        include <GLES3/gl3.h>
+#    endif
+#endif
+
+#include <array>
+#include <cstring>
+#include <vector>
+
+namespace lxgui::gui::gl {
+
+stream_buffer::stream_buffer(std::size_t capacity) :
+    capacity_(capacity), capacity_bytes_(capacity * sizeof(vertex)) {
+    static constexpr std::array<std::uint32_t, 6> quad_i_ds = {{0, 1, 2, 2, 3, 0}};
+
+    if (capacity_ % 4 != 0) {
+        throw gui::exception(
+            "gui::gl::stream_buffer",
+            "Capacity must be a multiple of 4 (got " + utils::to_string(capacity_) + ").");
+    }
+
+    std::array<std::uint32_t, 4> arrays;
+    glGenVertexArrays(arrays.size(), arrays.data());
+    vertex_array_        = arrays[0];
+    packed_vertex_array_ = arrays[1];
+    instance_array_      = arrays[2];
+    attribute_array_     = arrays[3];
+
+    std::array<std::uint32_t, 2> buffers;
+    glGenBuffers(buffers.size(), buffers.data());
+    vertex_buffer_ = buffers[0];
+    index_buffer_  = buffers[1];
+
+    // Indices are the same for all batches, thanks to the base vertex offset
+    const std::size_t          num_indices = (capacity_ / 4u) * 6u;
+    std::vector<std::uint32_t> repeated_ids(num_indices);
+    for (std::size_t i = 0; i < num_indices; ++i) {
+        repeated_ids[i] = (i / 6) * 4 + quad_i_ds[i % 6];
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_);
+    glBufferData(GL_ARRAY_BUFFER, capacity_bytes_, nullptr, GL_STREAM_DRAW);
+
+    for (const std::uint32_t array : {vertex_array_, packed_vertex_array_, attribute_array_}) {
+        glBindVertexArray(array);
+
+        glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_);
+        glEnableVertexAttribArray(0);
+        glEnableVertexAttribArray(1);
+        glEnableVertexAttribArray(2);
+        set_vertex_attributes(array == packed_vertex_array_);
+
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_buffer_);
+        if (array == vertex_array_) {
+            glBufferData(
+                GL_ELEMENT_ARRAY_BUFFER, sizeof(std::uint32_t) * num_indices, repeated_ids.data(),
+                GL_STATIC_DRAW);
+        }
+    }
+
+    // Instances do not use indices; attribute pointers are set when rendering
+    glBindVertexArray(instance_array_);
+    for (std::uint32_t i = 0u; i < num_instance_attributes; ++i) {
+        glEnableVertexAttribArray(first_instance_attribute + i);
+        glVertexAttribDivisor(first_instance_attribute + i, 1);
+    }
+
+    glBindVertexArray(0);
+}
+
+stream_buffer::~stream_buffer() {
+#if !defined(LXGUI_COMPILER_EMSCRIPTEN)
+    for (const auto& f : fence_list_)
+        glDeleteSync(static_cast<GLsync>(f.sync));
+#endif
+
+    std::array<std::uint32_t, 4> arrays = {
+        vertex_array_, packed_vertex_array_, instance_array_, attribute_array_};
+    glDeleteVertexArrays(arrays.size(), arrays.data());
+
+    std::array<std::uint32_t, 2> buffers = {vertex_buffer_, index_buffer_};
+    glDeleteBuffers(buffers.size(), buffers.data());
+}
+
+std::size_t stream_buffer::get_capacity() const {
+    return capacity_;
+}
+
+void stream_buffer::set_packed_vertex_enabled(bool enabled) {
+    packed_vertex_enabled_ = enabled;
+}
+
+bool stream_buffer::is_packed_vertex_enabled() const {
+    return packed_vertex_enabled_;
+}
+
+std::size_t stream_buffer::allocate_(std::size_t num_bytes) {
+    // NB: the vertex buffer must be bound
+    std::size_t offset = position_ % capacity_bytes_;
+    if (offset + num_bytes > capacity_bytes_) {
+        // Not enough room left at the end of the buffer, wrap around
+        position_ += capacity_bytes_ - offset;
+        offset = 0u;
+
+#if defined(LXGUI_COMPILER_EMSCRIPTEN)
+        // Orphan the buffer; the driver keeps the old storage alive for pending draw calls
+        glBufferData(GL_ARRAY_BUFFER, capacity_bytes_, nullptr, GL_STREAM_DRAW);
+#endif
+    }
+
+    const std::uint64_t end = position_ + num_bytes;
+
+#if !defined(LXGUI_COMPILER_EMSCRIPTEN)
+    // The region we are about to write was last used 'capacity_bytes_' bytes ago
+    if (end > capacity_bytes_)
+        wait_for_(end - capacity_bytes_);
+#endif
+
+    // Keep batches aligned on the largest vertex size, so the offset of each batch
+    // can be expressed as a number of vertices, whatever the layout
+    position_ = (end + sizeof(vertex) - 1u) / sizeof(vertex) * sizeof(vertex);
+
+    return offset;
+}
+
+void stream_buffer::wait_for_(std::uint64_t position [[maybe_unused]]) {
+#if !defined(LXGUI_COMPILER_EMSCRIPTEN)
+    // NB: the vertex buffer must be bound
+    if (position <= completed_position_)
+        return;
+
+    // Fences are signaled in order, so we only need to wait for the first fence
+    // inserted after the requested position; the fences before it are redundant.
+    while (!fence_list_.empty() && fence_list_.front().position < position) {
+        glDeleteSync(static_cast<GLsync>(fence_list_.front().sync));
+        fence_list_.pop_front();
+    }
+
+    if (fence_list_.empty()) {
+        // The whole buffer was used since the last fence. Rather than waiting for the GPU
+        // to catch up, orphan the buffer: the driver keeps the old storage alive for the
+        // pending draw calls, and everything written so far is safe to overwrite.
+        glBufferData(GL_ARRAY_BUFFER, capacity_bytes_, nullptr, GL_STREAM_DRAW);
+        completed_position_ = position_;
+        return;
+    }
+
+    GLsync     sync  = static_cast<GLsync>(fence_list_.front().sync);
+    GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+    while (glClientWaitSync(sync, flags, 1000000u) == GL_TIMEOUT_EXPIRED)
+        flags = 0;
+
+    completed_position_ = fence_list_.front().position;
+    glDeleteSync(sync);
+    fence_list_.pop_front();
+#endif
+}
+
+void stream_buffer::fence() {
+#if !defined(LXGUI_COMPILER_EMSCRIPTEN)
+    if (!fence_list_.empty() && fence_list_.back().position == position_)
+        return;
+
+    fence_list_.push_back({glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), position_});
+#endif
+}
+
+void stream_buffer::write_(std::size_t offset, const void* data, std::size_t num_bytes) {
+    // NB: the vertex buffer must be bound
+#if !defined(LXGUI_COMPILER_EMSCRIPTEN)
+    void* mapped = glMapBufferRange(
+        GL_ARRAY_BUFFER, offset, num_bytes,
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+
+    if (mapped) {
+        std::memcpy(mapped, data, num_bytes);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+        return;
+    }
+#endif
+
+    glBufferSubData(GL_ARRAY_BUFFER, offset, num_bytes, data);
+}
+
+void stream_buffer::render_quads(const vertex* vertex_data, std::size_t num_vertex) {
+    static thread_local std::vector<packed_vertex> packed_data;
+
+    if (num_vertex % 4 != 0) {
+        throw gui::exception(
+            "gui::gl::stream_buffer",
+            "Number of vertices in quad array must be a multiple of 4 (got " +
+                utils::to_string(num_vertex) + ").");
+    }
+
+    if (num_vertex > capacity_) {
+        throw gui::exception(
+            "gui::gl::stream_buffer", "Number of vertices exceeds the buffer capacity (" +
+                                          utils::to_string(num_vertex) + " > " +
+                                          utils::to_string(capacity_) + ").");
+    }
+
+    const bool packed =
+        packed_vertex_enabled_ && pack_vertices(vertex_data, num_vertex, packed_data);
+
+    const std::size_t vertex_size = packed ? sizeof(packed_vertex) : sizeof(vertex);
+    const std::size_t num_bytes   = vertex_size * num_vertex;
+    const void*       data        = packed ? static_cast<const void*>(packed_data.data())
+                                           : static_cast<const void*>(vertex_data);
+
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_);
+    const std::size_t offset = allocate_(num_bytes);
+
+    write_(offset, data, num_bytes);
+
+    const std::size_t num_indices = (num_vertex / 4u) * 6u;
+
+    glBindVertexArray(packed ? packed_vertex_array_ : vertex_array_);
+
+#if !defined(LXGUI_COMPILER_EMSCRIPTEN)
+    glDrawElementsBaseVertex(
+        GL_TRIANGLES, num_indices, GL_UNSIGNED_INT, 0, static_cast<GLint>(offset / vertex_size));
+#else
+    // WebGL has no base vertex support, move the attribute pointers instead
+    set_vertex_attributes(packed, offset);
+    glDrawElements(GL_TRIANGLES, num_indices, GL_UNSIGNED_INT, 0);
+#endif
+
+    glBindVertexArray(0);
+}
+
+void stream_buffer::render_quad_instances(
+    const quad_instance* instance_data, std::size_t num_instance) {
+    const std::size_t num_bytes = sizeof(quad_instance) * num_instance;
+    if (num_bytes > capacity_bytes_) {
+        throw gui::exception(
+            "gui::gl::stream_buffer", "Number of instances exceeds the buffer capacity (" +
+                                          utils::to_string(num_instance) + ").");
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_);
+    const std::size_t offset = allocate_(num_bytes);
+
+    write_(offset, instance_data, num_bytes);
+
+    // There is no base instance in GL3 / GLES3, move the attribute pointers instead
+    glBindVertexArray(instance_array_);
+    set_instance_attributes(offset);
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 6, num_instance);
+    glBindVertexArray(0);
+}
+
+void stream_buffer::render_multi_texture_quads(
+    const vertex*   vertex_data,
+    const float*    slot_data,
+    const bounds2f* tile_data,
+    std::size_t     num_vertex) {
+    render_with_attributes_(vertex_data, slot_data, tile_data, num_vertex);
+}
+
+void stream_buffer::render_tiled_quads(
+    const vertex* vertex_data, const bounds2f* tile_data, std::size_t num_vertex) {
+    render_with_attributes_(vertex_data, nullptr, tile_data, num_vertex);
+}
+
+void stream_buffer::render_with_attributes_(
+    const vertex*   vertex_data,
+    const float*    slot_data,
+    const bounds2f* tile_data,
+    std::size_t     num_vertex) {
+    if (num_vertex % 4 != 0) {
+        throw gui::exception(
+            "gui::gl::stream_buffer",
+            "Number of vertices in quad array must be a multiple of 4 (got " +
+                utils::to_string(num_vertex) + ").");
+    }
+
+    const std::size_t vertex_bytes = sizeof(vertex) * num_vertex;
+    const std::size_t slot_bytes   = slot_data ? sizeof(float) * num_vertex : 0u;
+    const std::size_t tile_bytes   = tile_data ? sizeof(bounds2f) * num_vertex : 0u;
+    const std::size_t num_bytes    = vertex_bytes + slot_bytes + tile_bytes;
+    if (num_bytes > capacity_bytes_) {
+        throw gui::exception(
+            "gui::gl::stream_buffer", "Number of vertices exceeds the buffer capacity (" +
+                                          utils::to_string(num_vertex) + ").");
+    }
+
+    // Vertices first, then texture slots and tiling regions, in a single allocation
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_);
+    const std::size_t offset      = allocate_(num_bytes);
+    const std::size_t slot_offset = offset + vertex_bytes;
+    const std::size_t tile_offset = slot_offset + slot_bytes;
+    write_(offset, vertex_data, vertex_bytes);
+    if (slot_data)
+        write_(slot_offset, slot_data, slot_bytes);
+    if (tile_data)
+        write_(tile_offset, tile_data, tile_bytes);
+
+    const std::size_t num_indices = (num_vertex / 4u) * 6u;
+
+    // Disabled attributes read as (0,0,0,1): texture slot zero, and no tiling region
+    glBindVertexArray(attribute_array_);
+    set_vertex_attributes(false, offset);
+
+    if (slot_data) {
+        glEnableVertexAttribArray(texture_slot_attribute);
+        glVertexAttribPointer(
+            texture_slot_attribute, 1, GL_FLOAT, GL_FALSE, sizeof(float),
+            reinterpret_cast<const void*>(slot_offset));
+    } else {
+        glDisableVertexAttribArray(texture_slot_attribute);
+    }
+
+    if (tile_data) {
+        glEnableVertexAttribArray(tile_rect_attribute);
+        glVertexAttribPointer(
+            tile_rect_attribute, 4, GL_FLOAT, GL_FALSE, sizeof(bounds2f),
+            reinterpret_cast<const void*>(tile_offset));
+    } else {
+        glDisableVertexAttribArray(tile_rect_attribute);
+    }
+
+    glDrawElements(GL_TRIANGLES, num_indices, GL_UNSIGNED_INT, 0);
+    glBindVertexArray(0);
+}
+
+} // namespace lxgui::gui::gl
@@ -23,10 +23,130 @@
 #    endif
 #endif
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
 
 namespace lxgui::gui::gl {
 
+namespace {
+
+template<typename T>
+T to_unorm(float value) {
+    constexpr float max_value = static_cast<float>(std::numeric_limits<T>::max());
+    return static_cast<T>(std::lround(std::clamp(value, 0.0f, 1.0f) * max_value));
+}
+
+color32 to_color32(const color& c) {
+    return color32{
+        to_unorm<color32::chanel>(c.r), to_unorm<color32::chanel>(c.g),
+        to_unorm<color32::chanel>(c.b), to_unorm<color32::chanel>(c.a)};
+}
+
+bool is_axis_aligned(
+    const vector2f& p0, const vector2f& p1, const vector2f& p2, const vector2f& p3) {
+    // The second and fourth points must be the other corners of the rectangle
+    // defined by the first and third points
+    return p1.x == p2.x && p1.y == p0.y && p3.x == p0.x && p3.y == p2.y;
+}
+
+void enable_attributes(std::uint32_t first, std::uint32_t count, bool enabled) {
+    for (std::uint32_t i = first; i < first + count; ++i) {
+        if (enabled)
+            glEnableVertexAttribArray(i);
+        else
+            glDisableVertexAttribArray(i);
+    }
+}
+
+} // namespace
+
+bool pack_vertices(
+    const vertex* vertex_data, std::size_t num_vertex, std::vector<packed_vertex>& packed_data) {
+    packed_data.resize(num_vertex);
+
+    for (std::size_t i = 0; i < num_vertex; ++i) {
+        const vertex& v = vertex_data[i];
+
+        // Texture coordinates outside of [0,1] (e.g., tiled textures) cannot be packed
+        if (v.uvs.x < 0.0f || v.uvs.x > 1.0f || v.uvs.y < 0.0f || v.uvs.y > 1.0f)
+            return false;
+
+        packed_vertex& p = packed_data[i];
+        p.pos            = v.pos;
+        p.uvs            = {to_unorm<std::uint16_t>(v.uvs.x), to_unorm<std::uint16_t>(v.uvs.y)};
+        p.col            = {
+            to_unorm<std::uint8_t>(v.col.r), to_unorm<std::uint8_t>(v.col.g),
+            to_unorm<std::uint8_t>(v.col.b), to_unorm<std::uint8_t>(v.col.a)};
+    }
+
+    return true;
+}
+
+void set_vertex_attributes(bool packed, std::size_t offset) {
+    const auto at = [&](std::size_t attribute_offset) {
+        return reinterpret_cast<const void*>(offset + attribute_offset);
+    };
+
+    if (packed) {
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(packed_vertex), at(0u));
+        glVertexAttribPointer(
+            1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(packed_vertex),
+            at(offsetof(packed_vertex, col)));
+        glVertexAttribPointer(
+            2, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(packed_vertex),
+            at(offsetof(packed_vertex, uvs)));
+    } else {
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(vertex), at(0u));
+        glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(vertex), at(sizeof(vector2f) * 2));
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(vertex), at(sizeof(vector2f)));
+    }
+}
+
+bool make_quad_instances(
+    const vertex* vertex_data, std::size_t num_vertex, std::vector<quad_instance>& instance_data) {
+    instance_data.resize(num_vertex / 4u);
+
+    for (std::size_t i = 0; i < instance_data.size(); ++i) {
+        const vertex* v = vertex_data + i * 4u;
+
+        if (!is_axis_aligned(v[0].pos, v[1].pos, v[2].pos, v[3].pos) ||
+            !is_axis_aligned(v[0].uvs, v[1].uvs, v[2].uvs, v[3].uvs))
+            return false;
+
+        quad_instance& q = instance_data[i];
+        q.rect           = {v[0].pos.x, v[0].pos.y, v[2].pos.x, v[2].pos.y};
+        q.tex_rect       = {v[0].uvs.x, v[0].uvs.y, v[2].uvs.x, v[2].uvs.y};
+        for (std::size_t j = 0; j < 4u; ++j)
+            q.col[j] = to_color32(v[j].col);
+    }
+
+    return true;
+}
+
+void set_instance_attributes(std::size_t offset) {
+    const auto at = [&](std::size_t attribute_offset) {
+        return reinterpret_cast<const void*>(offset + attribute_offset);
+    };
+
+    constexpr std::uint32_t first = first_instance_attribute;
+
+    glVertexAttribPointer(
+        first, 4, GL_FLOAT, GL_FALSE, sizeof(quad_instance), at(offsetof(quad_instance, rect)));
+    glVertexAttribPointer(
+        first + 1, 4, GL_FLOAT, GL_FALSE, sizeof(quad_instance),
+        at(offsetof(quad_instance, tex_rect)));
+
+    for (std::uint32_t i = 0u; i < 4u; ++i) {
+        glVertexAttribPointer(
+            first + 2 + i, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(quad_instance),
+            at(offsetof(quad_instance, col) + sizeof(color32) * i));
+    }
+}
+
 vertex_cache::vertex_cache(type t) : gui::vertex_cache(t) {
     glGenVertexArrays(1, &vertex_array_);
 
@@ -39,14 +159,12 @@ vertex_cache::vertex_cache(type t) : gui::vertex_cache(t) {
 
     glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_);
     glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(vertex), 0);
     glEnableVertexAttribArray(1);
-    glVertexAttribPointer(
-        1, 4, GL_FLOAT, GL_FALSE, sizeof(vertex),
-        reinterpret_cast<const void*>(sizeof(vector2f) * 2));
     glEnableVertexAttribArray(2);
-    glVertexAttribPointer(
-        2, 2, GL_FLOAT, GL_FALSE, sizeof(vertex), reinterpret_cast<const void*>(sizeof(vector2f)));
+    set_vertex_attributes(false);
+
+    for (std::uint32_t i = 0u; i < num_instance_attributes; ++i)
+        glVertexAttribDivisor(first_instance_attribute + i, 1);
 
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_buffer_);
 
@@ -60,15 +178,51 @@ vertex_cache::~vertex_cache() {
     glDeleteBuffers(buffers.size(), buffers.data());
 }
 
-void vertex_cache::update_data(const vertex* vertex_data, std::size_t num_vertex) {
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_);
+void vertex_cache::set_layout_(layout new_layout) {
+    // NB: the vertex buffer must be bound
+    if (new_layout == current_layout_)
+        return;
+
+    glBindVertexArray(vertex_array_);
+
+    const bool instanced = new_layout == layout::quad_instance;
+    if (instanced != (current_layout_ == layout::quad_instance)) {
+        enable_attributes(0u, 3u, !instanced);
+        enable_attributes(first_instance_attribute, num_instance_attributes, instanced);
+    }
 
-    if (num_vertex > current_capacity_vertex_) {
-        glBufferData(GL_ARRAY_BUFFER, sizeof(vertex) * num_vertex, vertex_data, GL_DYNAMIC_DRAW);
-        current_capacity_vertex_ = num_vertex;
+    if (instanced)
+        set_instance_attributes();
+    else
+        set_vertex_attributes(new_layout == layout::packed_vertex);
+
+    glBindVertexArray(0);
+
+    current_layout_ = new_layout;
+}
+
+void vertex_cache::upload_vertex_data_(const void* data, std::size_t num_bytes) {
+    if (num_bytes > current_capacity_bytes_) {
+        glBufferData(GL_ARRAY_BUFFER, num_bytes, data, GL_DYNAMIC_DRAW);
+        current_capacity_bytes_ = num_bytes;
     } else {
-        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertex) * num_vertex, vertex_data);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, num_bytes, data);
     }
+}
+
+void vertex_cache::update_data(const vertex* vertex_data, std::size_t num_vertex) {
+    static thread_local std::vector<packed_vertex> packed_data;
+
+    const bool packed =
+        packed_vertex_enabled_ && pack_vertices(vertex_data, num_vertex, packed_data);
+
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_);
+    set_layout_(packed ? layout::packed_vertex : layout::vertex);
+
+    if (packed)
+        upload_vertex_data_(packed_data.data(), sizeof(packed_vertex) * num_vertex);
+    else
+        upload_vertex_data_(vertex_data, sizeof(vertex) * num_vertex);
 
     current_size_vertex_ = num_vertex;
 }
@@ -105,6 +259,7 @@ void vertex_cache::update(const vertex* vertex_data, std::size_t num_vertex) {
     if (type_ == type::quads) {
         static constexpr std::array<std::uint32_t, 6>  quad_i_ds = {{0, 1, 2, 2, 3, 0}};
         static thread_local std::vector<std::uint32_t> repeated_ids;
+        static thread_local std::vector<quad_instance>  instance_data;
 
         if (num_vertex % 4 != 0) {
             throw gui::exception(
@@ -113,6 +268,19 @@ void vertex_cache::update(const vertex* vertex_data, std::size_t num_vertex) {
                     utils::to_string(num_vertex) + ").");
         }
 
+        if (instanced_quads_enabled_ &&
+            make_quad_instances(vertex_data, num_vertex, instance_data)) {
+            // Store one instance per quad; no index needed
+            glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_);
+            set_layout_(layout::quad_instance);
+            upload_vertex_data_(instance_data.data(), sizeof(quad_instance) * instance_data.size());
+
+            current_size_vertex_   = num_vertex;
+            current_size_instance_ = instance_data.size();
+            num_vertex_            = current_size_instance_ * 6u;
+            return;
+        }
+
         // Update the vertex data
         update_data(vertex_data, num_vertex);
 
@@ -156,9 +324,34 @@ void vertex_cache::update(const vertex* vertex_data, std::size_t num_vertex) {
     }
 }
 
+void vertex_cache::set_packed_vertex_enabled(bool enabled) {
+    packed_vertex_enabled_ = enabled;
+}
+
+bool vertex_cache::is_packed_vertex_enabled() const {
+    return packed_vertex_enabled_;
+}
+
+void vertex_cache::set_instanced_quads_enabled(bool enabled) {
+    instanced_quads_enabled_ = enabled;
+}
+
+bool vertex_cache::is_instanced_quads_enabled() const {
+    return instanced_quads_enabled_;
+}
+
+bool vertex_cache::is_instanced() const {
+    return current_layout_ == layout::quad_instance;
+}
+
 void vertex_cache::render() const {
     glBindVertexArray(vertex_array_);
-    glDrawElements(GL_TRIANGLES, current_size_index_, GL_UNSIGNED_INT, 0);
+
+    if (current_layout_ == layout::quad_instance)
+        glDrawArraysInstanced(GL_TRIANGLES, 0, 6, current_size_instance_);
+    else
+        glDrawElements(GL_TRIANGLES, current_size_index_, GL_UNSIGNED_INT, 0);
+
     glBindVertexArray(0);
 }
 
@@ -65,6 +65,10 @@ atlas_page::add_material_(const gui::material& mat, const bounds2f& location) {
         throw;
     }
 
+    return create_material_(location);
+}
+
+std::shared_ptr<gui::material> atlas_page::create_material_(const bounds2f& location) const {
     return std::make_shared<sdl::material>(
         renderer_.get_sdl_renderer(), texture_, location, filter_);
 }
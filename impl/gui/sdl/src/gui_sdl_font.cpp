@@ -186,6 +186,14 @@ font::font(
 
     TTF_CloseFont(fnt);
 
+    // Build look up table
+    for (const auto& info : range_list_) {
+        for (const auto& ci : info.data)
+            character_map_.set(ci.code_point, &ci);
+    }
+
+    default_character_ = character_map_.get(default_code_point_);
+
     // Pre-multiply alpha
     if (pre_multiplied_alpha_supported) {
         const std::size_t area = canvas_dimensions.x * canvas_dimensions.y;
@@ -205,17 +213,10 @@ std::size_t font::get_size() const {
 }
 
 const font::character_info* font::get_character_(char32_t c) const {
-    for (const auto& info : range_list_) {
-        if (c < info.range.first || c > info.range.last)
-            continue;
-
-        return &info.data[c - info.range.first];
-    }
+    if (const character_info* info = character_map_.get(c))
+        return info;
 
-    if (c != default_code_point_)
-        return get_character_(default_code_point_);
-    else
-        return nullptr;
+    return default_character_;
 }
 
 bounds2f font::get_character_uvs(char32_t c) const {
@@ -252,6 +253,24 @@ float font::get_character_height(char32_t c) const {
     return info->rect.height();
 }
 
+void font::get_character_metrics(
+    const char32_t* characters, std::size_t count, character_metrics* output) const {
+    for (std::size_t i = 0; i < count; ++i) {
+        const character_info* info = get_character_(characters[i]);
+        if (!info) {
+            output[i] = character_metrics{};
+            continue;
+        }
+
+        vector2f top_left     = texture_->get_canvas_uv(info->uvs.top_left(), true);
+        vector2f bottom_right = texture_->get_canvas_uv(info->uvs.bottom_right(), true);
+
+        output[i].uvs     = bounds2f(top_left.x, bottom_right.x, top_left.y, bottom_right.y);
+        output[i].bounds  = info->rect;
+        output[i].advance = info->advance;
+    }
+}
+
 float font::get_character_kerning(char32_t, char32_t) const {
     // Note: SDL_ttf does not expose kerning
     return 0.0f;
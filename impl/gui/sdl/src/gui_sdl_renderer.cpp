@@ -12,6 +12,7 @@
 
 #include <SDL.h>
 #include <SDL_image.h>
+#include <cmath>
 
 namespace lxgui::gui::sdl {
 
@@ -72,6 +73,8 @@ void renderer::begin_(std::shared_ptr<gui::render_target> target) {
     }
 
     view_matrix_ = target_view_matrix_;
+
+    SDL_RenderSetClipRect(renderer_, nullptr);
 }
 
 void renderer::end_() {
@@ -90,6 +93,30 @@ matrix4f renderer::get_view() const {
     return raw_view_matrix_;
 }
 
+bool renderer::is_scissor_supported() const {
+    return true;
+}
+
+void renderer::set_scissor_(const bounds2f* rect) {
+    if (!rect) {
+        SDL_RenderSetClipRect(renderer_, nullptr);
+        return;
+    }
+
+    // Convert from screen-space to pixels
+    const matrix4f screen_to_pixels = matrix4f::invert(target_view_matrix_);
+    const vector2f top_left         = rect->top_left() * screen_to_pixels;
+    const vector2f bottom_right     = rect->bottom_right() * screen_to_pixels;
+
+    SDL_Rect clip_rect;
+    clip_rect.x = static_cast<int>(std::floor(top_left.x));
+    clip_rect.y = static_cast<int>(std::floor(top_left.y));
+    clip_rect.w = static_cast<int>(std::ceil(bottom_right.x)) - clip_rect.x;
+    clip_rect.h = static_cast<int>(std::ceil(bottom_right.y)) - clip_rect.y;
+
+    SDL_RenderSetClipRect(renderer_, &clip_rect);
+}
+
 color premultiply_alpha(const color& c, bool pre_multiplied_alpha_supported) {
     if (pre_multiplied_alpha_supported)
         return color(c.r * c.a, c.g * c.a, c.b * c.a, c.a);
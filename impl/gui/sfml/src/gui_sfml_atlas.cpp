@@ -27,6 +27,10 @@ atlas_page::add_material_(const gui::material& mat, const bounds2f& location) {
     const sf::Image image = sf_mat.get_texture()->copyToImage();
     texture_.update(image, location.left, location.top);
 
+    return create_material_(location);
+}
+
+std::shared_ptr<gui::material> atlas_page::create_material_(const bounds2f& location) const {
     return std::make_shared<sfml::material>(texture_, location, filter_);
 }
 
@@ -13,23 +13,77 @@ font::font(
     std::size_t                          outline,
     const std::vector<code_point_range>& code_points,
     char32_t                             default_code_point) :
-    size_(size),
-    outline_(outline),
-    default_code_point_(default_code_point),
-    code_points_(code_points) {
+    size_(size), outline_(outline), default_code_point_(default_code_point) {
     if (!font_.loadFromFile(font_file)) {
         throw gui::exception("gui::sfml::font", "Could not load font file '" + font_file + "'.");
     }
 
     // Need to request in advance the glyphs that we will use
     // in order for SFLM to draw them on its internal texture
-    for (const code_point_range& range : code_points_) {
+    for (const code_point_range& range : code_points) {
         for (char32_t code_point = range.first; code_point <= range.last; ++code_point) {
             font_.getGlyph(code_point, size_, false, outline);
         }
     }
 
     sf::Image data = font_.getTexture(size_).copyToImage();
+
+    // Store glyph data now that the texture is final, so we do not need to query SFML again
+    const float texture_width  = static_cast<float>(data.getSize().x);
+    const float texture_height = static_cast<float>(data.getSize().y);
+
+    // TODO: this should use the font ascender + descender for y_offset
+    // https://github.com/cschreib/lxgui/issues/97
+    const float y_offset = size_;
+
+    range_list_.reserve(code_points.size());
+    for (const code_point_range& range : code_points) {
+        range_info info;
+        info.range = range;
+        info.data.resize(range.last - range.first + 1);
+
+        for (char32_t code_point = range.first; code_point <= range.last; ++code_point) {
+            const sf::Glyph& glyph = font_.getGlyph(code_point, size_, false, outline);
+
+            character_info& ci = info.data[code_point - range.first];
+            ci.code_point      = code_point;
+            ci.advance         = glyph.advance;
+
+            const sf::IntRect& tex_rect = glyph.textureRect;
+            ci.uvs.left                 = tex_rect.left / texture_width;
+            ci.uvs.right                = (tex_rect.left + tex_rect.width) / texture_width;
+            ci.uvs.top                  = tex_rect.top / texture_height;
+            ci.uvs.bottom               = (tex_rect.top + tex_rect.height) / texture_height;
+
+            const sf::FloatRect& bounds = glyph.bounds;
+
+#if defined(SFML_HAS_OUTLINE_GLYPH_FIX)
+            // This code requires https://github.com/SFML/SFML/pull/1827
+            ci.rect.left   = bounds.left;
+            ci.rect.right  = bounds.left + bounds.width;
+            ci.rect.top    = bounds.top + y_offset;
+            ci.rect.bottom = bounds.top + y_offset + bounds.height;
+#else
+            const float offset = static_cast<float>(outline_);
+
+            ci.rect.left   = bounds.left - offset;
+            ci.rect.right  = bounds.left - offset + bounds.width;
+            ci.rect.top    = bounds.top - offset + y_offset;
+            ci.rect.bottom = bounds.top - offset + y_offset + bounds.height;
+#endif
+        }
+
+        range_list_.push_back(std::move(info));
+    }
+
+    // Build look up table
+    for (const auto& info : range_list_) {
+        for (const auto& ci : info.data)
+            character_map_.set(ci.code_point, &ci);
+    }
+
+    default_character_ = character_map_.get(default_code_point_);
+
     sfml::material::premultiply_alpha(data);
     texture_ = std::make_shared<sfml::material>(data);
 }
@@ -38,93 +92,80 @@ std::size_t font::get_size() const {
     return size_;
 }
 
-char32_t font::get_character_(char32_t c) const {
-    for (const auto& range : code_points_) {
-        if (c < range.first || c > range.last)
-            continue;
+const font::character_info* font::get_character_(char32_t c) const {
+    if (const character_info* info = character_map_.get(c))
+        return info;
 
-        return c;
-    }
-
-    if (c != default_code_point_)
-        return get_character_(default_code_point_);
-    else
-        return 0;
+    return default_character_;
 }
 
 bounds2f font::get_character_uvs(char32_t c) const {
-    c = get_character_(c);
-    if (c == 0)
+    const character_info* info = get_character_(c);
+    if (!info)
         return bounds2f{};
 
-    const sf::IntRect& sf_rect  = font_.getGlyph(c, size_, false, outline_).textureRect;
-    const bounds2f&    tex_rect = texture_->get_rect();
-
-    bounds2f rect;
-    rect.left   = sf_rect.left / tex_rect.width();
-    rect.right  = (sf_rect.left + sf_rect.width) / tex_rect.width();
-    rect.top    = sf_rect.top / tex_rect.height();
-    rect.bottom = (sf_rect.top + sf_rect.height) / tex_rect.height();
-
-    vector2f top_left     = texture_->get_canvas_uv(rect.top_left(), true);
-    vector2f bottom_right = texture_->get_canvas_uv(rect.bottom_right(), true);
+    vector2f top_left     = texture_->get_canvas_uv(info->uvs.top_left(), true);
+    vector2f bottom_right = texture_->get_canvas_uv(info->uvs.bottom_right(), true);
     return bounds2f(top_left.x, bottom_right.x, top_left.y, bottom_right.y);
 }
 
 bounds2f font::get_character_bounds(char32_t c) const {
-    c = get_character_(c);
-    if (c == 0)
+    const character_info* info = get_character_(c);
+    if (!info)
         return bounds2f{};
 
-    // TODO: this should use the font ascender + descender for y_offset
-    // https://github.com/cschreib/lxgui/issues/97
-    const float y_offset = size_;
-
-    const sf::FloatRect& sf_rect = font_.getGlyph(c, size_, false, outline_).bounds;
-
-    bounds2f rect;
-
-#if defined(SFML_HAS_OUTLINE_GLYPH_FIX)
-    // This code requires https://github.com/SFML/SFML/pull/1827
-    rect.left   = sf_rect.left;
-    rect.right  = sf_rect.left + sf_rect.width;
-    rect.top    = sf_rect.top + y_offset;
-    rect.bottom = sf_rect.top + y_offset + sf_rect.height;
-#else
-    const float offset = static_cast<float>(outline_);
-
-    rect.left   = sf_rect.left - offset;
-    rect.right  = sf_rect.left - offset + sf_rect.width;
-    rect.top    = sf_rect.top - offset + y_offset;
-    rect.bottom = sf_rect.top - offset + y_offset + sf_rect.height;
-#endif
-
-    return rect;
+    return info->rect;
 }
 
 float font::get_character_width(char32_t c) const {
-    c = get_character_(c);
-    if (c == 0)
+    const character_info* info = get_character_(c);
+    if (!info)
         return 0.0f;
 
-    return font_.getGlyph(c, size_, false, outline_).advance;
+    return info->advance;
 }
 
 float font::get_character_height(char32_t c) const {
-    c = get_character_(c);
-    if (c == 0)
+    const character_info* info = get_character_(c);
+    if (!info)
         return 0.0f;
 
-    return font_.getGlyph(c, size_, false, outline_).bounds.height;
+    return info->rect.height();
+}
+
+void font::get_character_metrics(
+    const char32_t* characters, std::size_t count, character_metrics* output) const {
+    for (std::size_t i = 0; i < count; ++i) {
+        const character_info* info = get_character_(characters[i]);
+        if (!info) {
+            output[i] = character_metrics{};
+            continue;
+        }
+
+        vector2f top_left     = texture_->get_canvas_uv(info->uvs.top_left(), true);
+        vector2f bottom_right = texture_->get_canvas_uv(info->uvs.bottom_right(), true);
+
+        output[i].uvs     = bounds2f(top_left.x, bottom_right.x, top_left.y, bottom_right.y);
+        output[i].bounds  = info->rect;
+        output[i].advance = info->advance;
+    }
 }
 
 float font::get_character_kerning(char32_t c1, char32_t c2) const {
-    c1 = get_character_(c1);
-    c2 = get_character_(c2);
-    if (c1 == 0 || c2 == 0)
+    const character_info* prev = get_character_(c1);
+    const character_info* next = get_character_(c2);
+    if (!prev || !next)
         return 0.0f;
 
-    return font_.getKerning(c1, c2, size_);
+    const std::uint64_t key =
+        (static_cast<std::uint64_t>(prev->code_point) << 32) | next->code_point;
+    auto iter = kerning_cache_.find(key);
+    if (iter != kerning_cache_.end())
+        return iter->second;
+
+    const float value = font_.getKerning(prev->code_point, next->code_point, size_);
+    kerning_cache_.emplace(key, value);
+    return value;
 }
 
 std::weak_ptr<gui::material> font::get_texture() const {
@@ -53,6 +53,18 @@ public:
      */
     void load_addon_directory(const std::string& directory);
 
+    /**
+     * \brief Destroys all frames created by an addon, and loads the addon again.
+     * \param addon_name The name of the addon (name of its directory)
+     * \return 'true' if the addon was found and re-loaded, 'false' otherwise
+     * \note The addon's saved variables are saved before destroying its frames, and
+     * read again when the addon is re-loaded. The addon's .toc file is also read
+     * again, so new files can be added to the addon.
+     * \warning Do not call this function while the manager is running update_ui()
+     * (i.e., do not call this directly from a frame's callback, C++ or Lua).
+     */
+    bool reload_addon(const std::string& addon_name);
+
     /**
      * \brief Returns the addon that is being parsed.
      * \return The addon that is being parsed
@@ -78,6 +90,8 @@ private:
 
     void save_variables_(const addon& a) const noexcept;
 
+    void destroy_addon_frames_(const addon& a);
+
     void parse_layout_file_(const std::string& file_name, const addon& a);
 
     template<typename T>
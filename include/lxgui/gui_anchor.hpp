@@ -121,6 +121,16 @@ public:
      */
     vector2f get_point(const region& object) const;
 
+    /**
+     * \brief Returns this anchor's absolute coordinates (in pixels).
+     * \param object The object owning this anchor
+     * \param target_dimensions The dimensions of the object's render target
+     * \return The absolute coordinates of this anchor.
+     * \note Unlike get_point(const region&), this does not access the object's frame
+     * renderer, and can be called from a worker thread.
+     */
+    vector2f get_point(const region& object, const vector2f& target_dimensions) const;
+
     /**
      * \brief Returns this anchor's parent region.
      * \return This anchor's parent region
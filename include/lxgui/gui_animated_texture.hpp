@@ -156,7 +156,7 @@ private:
     void parse_gradient_node_(const layout_node& node);
 
     void update_tex_coords_();
-    void update_borders_() override;
+    void notify_borders_updated_(const bounds2f& old_border_list, bool old_valid) override;
 
     const std::vector<std::string>& get_type_list_() const override;
 
@@ -0,0 +1,285 @@
+#ifndef LXGUI_GUI_ANIMATION_HPP
+#define LXGUI_GUI_ANIMATION_HPP
+
+#include "lxgui/gui_color.hpp"
+#include "lxgui/gui_vector2.hpp"
+#include "lxgui/lxgui.hpp"
+#include "lxgui/utils.hpp"
+#include "lxgui/utils_observer.hpp"
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace lxgui::gui {
+
+class frame;
+class region;
+
+/// Property animated by an #animation.
+enum class animation_type {
+    /// Alpha (opacity) of a region
+    alpha,
+    /// Position offset of a frame (in pixels), applied when rendering
+    translation,
+    /// Scale of a frame (around its center), applied when rendering
+    scale,
+    /// Rotation of a frame (around its center), applied when rendering
+    rotation,
+    /// Vertex color of a texture, or text color of a font_string
+    color,
+    /// Texture coordinates of a texture
+    tex_coords
+};
+
+/// Easing function of an #animation.
+enum class animation_smoothing { none, in, out, in_out };
+
+/// Behavior of an #animation_group when it reaches its end.
+enum class animation_looping {
+    /// Stop playing
+    none,
+    /// Start again from the beginning
+    repeat,
+    /// Play backwards, then forwards again, and so on
+    bounce
+};
+
+/**
+ * \brief A single tween, part of an #animation_group.
+ * \details An animation interpolates one property of a region, from a start value to an
+ * end value, over a given duration. Only the parameters corresponding to the type of the
+ * animation are used.
+ */
+struct animation {
+    animation_type      type      = animation_type::alpha;
+    animation_smoothing smoothing = animation_smoothing::none;
+
+    /**
+     * \brief Name of the animated region.
+     * \details If empty, the frame owning the animation group is animated. "$parent" is
+     * replaced by the name of the frame owning the animation group.
+     */
+    std::string target;
+
+    /// Animations with the same order run together, after those with a lower order.
+    std::size_t order       = 1u;
+    float       duration    = 0.0f;
+    float       start_delay = 0.0f;
+    float       end_delay   = 0.0f;
+
+    float from_alpha = 1.0f;
+    float to_alpha   = 1.0f;
+
+    /// Translation, in pixels.
+    vector2f offset;
+
+    vector2f from_scale = vector2f(1.0f, 1.0f);
+    vector2f to_scale   = vector2f(1.0f, 1.0f);
+
+    /// Rotation, in degrees (counter-clockwise).
+    float degrees = 0.0f;
+
+    color from_color = color::white;
+    color to_color   = color::white;
+
+    /// Texture coordinates, as (left, top, right, bottom), see texture::set_tex_rect().
+    std::array<float, 4> from_tex_rect{0.0f, 0.0f, 1.0f, 1.0f};
+    std::array<float, 4> to_tex_rect{0.0f, 0.0f, 1.0f, 1.0f};
+};
+
+/**
+ * \brief A set of animations, played together on a frame and its regions.
+ * \details Animation groups are owned by a frame (see frame::add_animation_group()). They
+ * are updated by the root once per frame, in C++, and their effect does not modify the
+ * layout: alpha, translation, scale, and rotation are only applied when rendering.
+ * Changing the color or texture coordinates updates the animated region directly; the
+ * original values are restored when the group stops.
+ *
+ * Animations are played in sequence, sorted by increasing order (see animation::order);
+ * animations sharing the same order are played simultaneously. Once an animation is
+ * finished, its end value is kept until the whole group is finished. Alpha animations
+ * waiting for their start delay apply their initial value (animation::from_alpha), and
+ * so do those of a later order until the first one starts. When the group finishes or
+ * is stopped, all the animated properties are reset (unless set_keep_final_state() was
+ * used), and the owner frame receives the `OnAnimationFinished` script (only when the
+ * group finishes normally).
+ *
+ * Simultaneous alpha animations of the same region are multiplied, including those of
+ * different groups. Likewise, translations and rotations of the same frame are added, and
+ * scales are multiplied; stopping one group only removes its own contribution. For colors
+ * and texture coordinates, if several groups animate the same region simultaneously, the
+ * last group updated takes precedence.
+ */
+class animation_group {
+public:
+    /**
+     * \brief Constructor.
+     * \param owner The frame owning this group
+     * \param name The name of this group
+     */
+    animation_group(frame& owner, std::string name);
+
+    // Non-copiable, non-movable
+    animation_group(const animation_group&)            = delete;
+    animation_group(animation_group&&)                 = delete;
+    animation_group& operator=(const animation_group&) = delete;
+    animation_group& operator=(animation_group&&)      = delete;
+
+    /**
+     * \brief Copies another group's animations into this one (inheritance).
+     * \param other The group to copy
+     */
+    void copy_from(const animation_group& other);
+
+    /**
+     * \brief Returns the name of this group.
+     * \return The name of this group
+     */
+    const std::string& get_name() const;
+
+    /**
+     * \brief Returns the frame owning this group.
+     * \return The frame owning this group
+     */
+    frame& get_owner() {
+        return owner_;
+    }
+
+    /**
+     * \brief Returns the frame owning this group.
+     * \return The frame owning this group
+     */
+    const frame& get_owner() const {
+        return owner_;
+    }
+
+    /**
+     * \brief Adds a new animation to this group.
+     * \param anim The animation
+     * \note If the group is playing, it is stopped first.
+     */
+    void add_animation(animation anim);
+
+    /**
+     * \brief Returns the animations of this group.
+     * \return The animations of this group
+     */
+    const std::vector<animation>& get_animations() const;
+
+    /**
+     * \brief Sets the behavior of this group when it reaches its end.
+     * \param looping The looping behavior
+     */
+    void set_looping(animation_looping looping);
+
+    /**
+     * \brief Returns the behavior of this group when it reaches its end.
+     * \return The looping behavior
+     */
+    animation_looping get_looping() const;
+
+    /**
+     * \brief Returns the total duration of this group (in seconds).
+     * \return The total duration of this group, for one loop
+     */
+    float get_duration() const;
+
+    /**
+     * \brief Sets whether the animated properties keep their final value once stopped.
+     * \param keep 'true' to keep the final state, 'false' to reset the properties
+     * \note This is the equivalent of WoW's `setToFinalAlpha`, for all the properties. The
+     * final state is kept until the group is played again or reset().
+     */
+    void set_keep_final_state(bool keep);
+
+    /**
+     * \brief Checks if the animated properties keep their final value once stopped.
+     * \return 'true' if the final state is kept, 'false' if the properties are reset
+     */
+    bool get_keep_final_state() const;
+
+    /**
+     * \brief Starts playing this group from the beginning.
+     * \note Target regions are resolved by name at this point.
+     */
+    void play();
+
+    /**
+     * \brief Stops playing this group, and resets all the animated properties.
+     * \note If set_keep_final_state() was used, the properties are set to their final
+     * value instead. This does not trigger the `OnAnimationFinished` script.
+     */
+    void stop();
+
+    /**
+     * \brief Stops playing this group, and resets all the animated properties.
+     * \note Unlike stop(), this also resets the final state kept with
+     * set_keep_final_state().
+     */
+    void reset();
+
+    /**
+     * \brief Checks if this group is playing.
+     * \return 'true' if this group is playing
+     */
+    bool is_playing() const;
+
+    /**
+     * \brief Advances this group in time, and applies the animations.
+     * \param delta The time elapsed since the last update (in seconds)
+     * \return 'true' if the group is still playing, 'false' if it has finished
+     * \note This is called by the owner frame. When the group finishes, the animated
+     * properties are reset, but the `OnAnimationFinished` script is not triggered:
+     * this is done by the owner frame.
+     */
+    bool update(float delta);
+
+private:
+    struct target_state {
+        utils::observer_ptr<region> target;
+
+        // Current values of properties applied when rendering
+        float    alpha    = 1.0f;
+        vector2f offset   = vector2f::zero;
+        vector2f scale    = vector2f(1.0f, 1.0f);
+        float    rotation = 0.0f;
+
+        // Order of the alpha animations applied at the current time
+        std::size_t alpha_order      = 0u;
+        bool        is_alpha_started = false;
+
+        // Original values of properties modified on the region, to restore when stopping
+        std::array<color, 4> original_colors{};
+        std::array<float, 8> original_tex_coords{};
+
+        bool has_alpha      = false;
+        bool has_transform  = false;
+        bool has_color      = false;
+        bool has_tex_coords = false;
+    };
+
+    void        update_timeline_();
+    std::size_t resolve_target_(const std::string& name);
+    void        apply_(float time);
+    void        reset_targets_();
+
+    frame&            owner_;
+    std::string       name_;
+    animation_looping looping_ = animation_looping::none;
+
+    std::vector<animation>    animation_list_;
+    std::vector<float>        start_time_list_;
+    std::vector<std::size_t>  target_index_list_;
+    std::vector<target_state> target_list_;
+    float                     duration_ = 0.0f;
+
+    bool  is_playing_       = false;
+    bool  is_reversed_      = false;
+    bool  keep_final_state_ = false;
+    float elapsed_          = 0.0f;
+};
+
+} // namespace lxgui::gui
+
+#endif
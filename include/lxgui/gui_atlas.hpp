@@ -81,6 +81,43 @@ public:
      */
     bool empty() const;
 
+    /**
+     * \brief Counts the materials and fonts in this page that are still in use.
+     * \return The number of materials and fonts in this page that are still in use
+     */
+    std::size_t get_resource_count() const;
+
+    /**
+     * \brief Appends all the materials and fonts of this page that are still in use.
+     * \param material_list The list to which materials are appended
+     * \param font_list The list to which fonts are appended
+     */
+    void collect_resources(
+        std::vector<std::shared_ptr<material>>& material_list,
+        std::vector<std::shared_ptr<font>>&     font_list) const;
+
+    /// Removes materials and fonts that are no longer used from this page.
+    void prune();
+
+    /**
+     * \brief Fills this page with a pre-packed page image.
+     * \param page_mat The material holding the page image
+     * \param material_list The name and location (in pixels) of each material in the image
+     * \return 'true' if the image was copied into this page, 'false' otherwise
+     * \note The page must be empty, and large enough to hold the whole image. Materials
+     * from the image are created when fetched (see fetch_material()), and the space they
+     * occupy is never used for other materials.
+     */
+    bool add_baked_page(
+        const material& page_mat, std::unordered_map<std::string, bounds2f> material_list);
+
+    /**
+     * \brief Checks if this page was filled with a pre-packed page image.
+     * \return 'true' if this page was filled with a pre-packed page image
+     * \note See add_baked_page().
+     */
+    bool is_baked() const;
+
 protected:
     /**
      * \brief Adds a new material to this page, at the provided location
@@ -91,6 +128,13 @@ protected:
     virtual std::shared_ptr<material>
     add_material_(const material& mat, const bounds2f& location) = 0;
 
+    /**
+     * \brief Creates a material pointing to a portion of this page
+     * \param location The position of the material in this page
+     * \return A new material pointing to inside this page
+     */
+    virtual std::shared_ptr<material> create_material_(const bounds2f& location) const = 0;
+
     /**
      * \brief Return the width of this page (in pixels).
      * \return The width of this page (in pixels)
@@ -116,6 +160,7 @@ private:
 
     std::unordered_map<std::string, std::weak_ptr<gui::material>> texture_list_;
     std::unordered_map<std::string, std::weak_ptr<gui::font>>     font_list_;
+    std::unordered_map<std::string, bounds2f>                     baked_material_list_;
 };
 
 /**
@@ -177,12 +222,39 @@ public:
      */
     bool add_font(const std::string& font_name, std::shared_ptr<gui::font> fnt);
 
+    /**
+     * \brief Loads pre-packed pages into this atlas, as produced by `lxgui-atlas-bake`.
+     * \param manifest_file The manifest file describing the pages
+     * \return 'true' if at least one page was loaded, 'false' otherwise
+     * \details Each page image is loaded in one go, and the materials listed in the
+     * manifest are then returned by fetch_material() directly from the pages, without
+     * loading or packing the original texture files. The names of the materials, and
+     * the page images, are relative to the directory of the manifest file.
+     * \note Loading the same manifest more than once has no effect.
+     */
+    bool load_baked_pages(const std::string& manifest_file);
+
     /**
      * \brief Return the number of pages in this atlas.
      * \return The number of pages in this atlas
      */
     std::size_t get_page_count() const;
 
+    /**
+     * \brief Appends all the materials and fonts of this atlas that are still in use.
+     * \param material_list The list to which materials are appended
+     * \param font_list The list to which fonts are appended
+     */
+    void collect_resources(
+        std::vector<std::shared_ptr<material>>& material_list,
+        std::vector<std::shared_ptr<font>>&     font_list) const;
+
+    /**
+     * \brief Removes materials and fonts that are no longer used from this atlas.
+     * \note Pages that no longer contain any used material or font are destroyed.
+     */
+    void prune();
+
 protected:
     /**
      * \brief Create a new page in this atlas.
@@ -205,7 +277,8 @@ private:
         std::shared_ptr<material>   no_texture_mat;
     };
 
-    std::vector<page_item> page_list_;
+    std::vector<page_item>   page_list_;
+    std::vector<std::string> baked_manifest_list_;
 };
 
 } // namespace lxgui::gui
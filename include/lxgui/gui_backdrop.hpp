@@ -8,7 +8,9 @@
 #include "lxgui/lxgui.hpp"
 #include "lxgui/utils.hpp"
 
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace lxgui::gui {
 
@@ -38,6 +40,8 @@ public:
     /**
      * \brief Copies a backdrop's parameters into this one (inheritance).
      * \param other The backdrop to copy
+     * \note The parameters are shared between the two backdrops, and only
+     * copied when one of the two backdrops is modified.
      */
     void copy_from(const backdrop& other);
 
@@ -178,34 +182,43 @@ public:
     void notify_borders_updated() const;
 
 private:
+    /// Parameters that can be shared between backdrops.
+    struct definition {
+        std::string               background_file;
+        color                     background_color = color::empty;
+        std::shared_ptr<material> background_texture;
+        bool                      is_background_tilling = false;
+        float                     tile_size             = 0.0f;
+        float                     original_tile_size    = 0.0f;
+        bounds2f                  background_insets;
+
+        std::string               edge_file;
+        color                     edge_color = color::empty;
+        std::shared_ptr<material> edge_texture;
+        bounds2f                  edge_insets;
+        float                     edge_size          = 0.0f;
+        float                     original_edge_size = 0.0f;
+    };
+
     void update_cache_() const;
     void update_background_(color c) const;
     void update_edge_(color c) const;
 
+    definition& get_mutable_definition_();
+
     frame& parent_;
 
-    std::string               background_file_;
-    color                     background_color_ = color::empty;
-    std::shared_ptr<material> background_texture_;
-    bool                      is_background_tilling_ = false;
-    float                     tile_size_             = 0.0f;
-    float                     original_tile_size_    = 0.0f;
-    bounds2f                  background_insets_;
-
-    std::string               edge_file_;
-    color                     edge_color_ = color::empty;
-    std::shared_ptr<material> edge_texture_;
-    bounds2f                  edge_insets_;
-    float                     edge_size_          = 0.0f;
-    float                     original_edge_size_ = 0.0f;
+    std::shared_ptr<definition> definition_;
 
     color vertex_color_ = color::white;
 
     mutable bool  is_cache_dirty_ = true;
     mutable float cache_alpha_    = std::numeric_limits<float>::quiet_NaN();
     mutable std::vector<std::array<vertex, 4>> background_quads_;
+    mutable std::vector<bounds2f>              background_tile_rects_;
     mutable std::shared_ptr<vertex_cache>      background_cache_;
     mutable std::vector<std::array<vertex, 4>> edge_quads_;
+    mutable std::vector<bounds2f>              edge_tile_rects_;
     mutable std::shared_ptr<vertex_cache>      edge_cache_;
 };
 
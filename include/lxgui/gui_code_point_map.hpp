@@ -0,0 +1,79 @@
+#ifndef LXGUI_GUI_CODE_POINT_MAP_HPP
+#define LXGUI_GUI_CODE_POINT_MAP_HPP
+
+#include "lxgui/lxgui.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace lxgui::gui {
+
+/**
+ * \brief Associates values to unicode code points, with constant time look up.
+ * \details This is a two-level page table: the code point space is split into pages of
+ * 256 consecutive code points, and storage is only allocated for pages that contain
+ * at least one value. Looking up a code point costs two array accesses, regardless of
+ * the number of stored values.
+ * \note Code points without an associated value map to a default-constructed T.
+ */
+template<typename T>
+class code_point_map {
+public:
+    /// Default constructor.
+    code_point_map() = default;
+
+    /**
+     * \brief Associates a value to a code point.
+     * \param c The unicode code point
+     * \param value The value to associate to this code point
+     */
+    void set(char32_t c, T value) {
+        const std::size_t page_id = static_cast<std::size_t>(c) >> page_bits;
+        if (page_id >= page_list_.size())
+            page_list_.resize(page_id + 1u, no_page);
+
+        if (page_list_[page_id] == no_page) {
+            page_list_[page_id] = static_cast<std::uint32_t>(pages_.size());
+            pages_.emplace_back();
+            pages_.back().fill(T{});
+        }
+
+        pages_[page_list_[page_id]][static_cast<std::size_t>(c) & page_mask] = std::move(value);
+    }
+
+    /**
+     * \brief Returns the value associated to a code point.
+     * \param c The unicode code point
+     * \return The value associated to this code point, or a default-constructed value if none
+     */
+    const T& get(char32_t c) const {
+        const std::size_t page_id = static_cast<std::size_t>(c) >> page_bits;
+        if (page_id >= page_list_.size() || page_list_[page_id] == no_page)
+            return empty_;
+
+        return pages_[page_list_[page_id]][static_cast<std::size_t>(c) & page_mask];
+    }
+
+    /// Removes all values.
+    void clear() {
+        page_list_.clear();
+        pages_.clear();
+    }
+
+private:
+    static constexpr std::size_t   page_bits = 8u;
+    static constexpr std::size_t   page_size = 1u << page_bits;
+    static constexpr std::size_t   page_mask = page_size - 1u;
+    static constexpr std::uint32_t no_page   = std::numeric_limits<std::uint32_t>::max();
+
+    std::vector<std::uint32_t>            page_list_;
+    std::vector<std::array<T, page_size>> pages_;
+    T                                     empty_ = T{};
+};
+
+} // namespace lxgui::gui
+
+#endif
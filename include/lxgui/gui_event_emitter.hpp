@@ -3,7 +3,7 @@
 
 #include "lxgui/gui_event_data.hpp"
 #include "lxgui/lxgui.hpp"
-#include "lxgui/utils_signal.hpp"
+#include "lxgui/utils_light_signal.hpp"
 
 #include <string>
 #include <unordered_map>
@@ -14,7 +14,7 @@ namespace lxgui::gui {
 using event_handler_signature = void(const event_data&);
 
 /// Signal type for scripts (used internally).
-using event_signal = utils::signal<event_handler_signature>;
+using event_signal = utils::light_signal<event_handler_signature>;
 
 /// C++ function type for UI script handlers.
 using event_handler_function = event_signal::function_type;
@@ -21,6 +21,13 @@ class material;
  */
 class font {
 public:
+    /// Metrics of a character, see get_character_metrics().
+    struct character_metrics {
+        bounds2f uvs; /// UV coordinates on the texture (see get_character_uvs())
+        bounds2f bounds; /// Rect relative to the baseline (see get_character_bounds())
+        float    advance = 0.0f; /// Width of the character (see get_character_width())
+    };
+
     /// Constructor.
     font() = default;
 
@@ -63,6 +70,17 @@ public:
      */
     virtual float get_character_height(char32_t c) const = 0;
 
+    /**
+     * \brief Returns the metrics of several characters at once.
+     * \param characters The unicode characters
+     * \param count The number of characters
+     * \param output The array that will receive the metrics (must have room for 'count' elements)
+     * \note This is equivalent to calling get_character_uvs(), get_character_bounds(), and
+     * get_character_width() for each character, but faster.
+     */
+    virtual void get_character_metrics(
+        const char32_t* characters, std::size_t count, character_metrics* output) const = 0;
+
     /**
      * \brief Return the kerning amount between two characters.
      * \param c1 The first unicode character
@@ -86,6 +104,16 @@ public:
      * \param mat The material to use for rendering
      */
     virtual void update_texture(std::shared_ptr<material> mat) = 0;
+
+    /**
+     * \brief Checks if this font can be copied into a texture atlas.
+     * \return 'true' if this font can be copied into a texture atlas, 'false' otherwise
+     * \note Fonts that share their texture with other fonts should not be copied into an atlas,
+     * since this would create one copy of the texture for each font.
+     */
+    virtual bool is_atlas_compatible() const {
+        return true;
+    }
 };
 
 } // namespace lxgui::gui
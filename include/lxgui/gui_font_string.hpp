@@ -63,6 +63,14 @@ public:
     /// Renders this region on the current render target.
     void render() const override;
 
+    /**
+     * \brief Returns the bounds of what this region renders.
+     * \return The bounds of what this region renders
+     * \note The text can overflow the borders of the font_string, depending on alignment,
+     * offset, and shadow. The returned bounds are conservative.
+     */
+    bounds2f get_render_bounds() const override;
+
     /**
      * \brief Copies a region's parameters into this font_string (inheritance).
      * \param obj The region to copy
@@ -435,6 +443,7 @@ private:
     bool is_vertex_cache_used_() const;
 
     void update_borders_() override;
+    bool can_compute_borders_in_parallel_() const override;
 
     std::unique_ptr<text> text_;
 
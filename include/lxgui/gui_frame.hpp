@@ -1,17 +1,21 @@
 #ifndef LXGUI_GUI_FRAME_HPP
 #define LXGUI_GUI_FRAME_HPP
 
+#include "lxgui/gui_animation.hpp"
 #include "lxgui/gui_backdrop.hpp"
 #include "lxgui/gui_event_receiver.hpp"
 #include "lxgui/gui_frame_core_attributes.hpp"
 #include "lxgui/gui_layered_region.hpp"
+#include "lxgui/gui_matrix4.hpp"
+#include "lxgui/gui_quad.hpp"
 #include "lxgui/gui_region.hpp"
 #include "lxgui/gui_strata.hpp"
 #include "lxgui/input_keys.hpp"
 #include "lxgui/lxgui.hpp"
 #include "lxgui/utils.hpp"
+#include "lxgui/utils_light_signal.hpp"
+#include "lxgui/utils_memory_pool.hpp"
 #include "lxgui/utils_meta.hpp"
-#include "lxgui/utils_signal.hpp"
 #include "lxgui/utils_view.hpp"
 
 #include <functional>
@@ -28,11 +32,15 @@ namespace lxgui::gui {
 
 class frame_renderer;
 class frame;
+class render_target;
 
 /// Contains gui::layered_region
 struct layer_container {
     bool                                             is_disabled = false;
-    std::vector<utils::observer_ptr<layered_region>> region_list;
+    std::vector<
+        utils::observer_ptr<layered_region>,
+        utils::arena_allocator<utils::observer_ptr<layered_region>>>
+        region_list;
 };
 
 /// Holds file/line information for a script.
@@ -45,7 +53,7 @@ struct script_info {
 using script_signature = void(frame&, const event_data&);
 
 /// Signal type for scripts (used internally).
-using script_signal = utils::signal<script_signature>;
+using script_signal = utils::light_signal<script_signature>;
 
 /// C++ function type for UI script handlers.
 using script_function = script_signal::function_type;
@@ -78,7 +86,8 @@ using script_list_view = script_signal::slot_list_view;
  * it will still remain below other frames in a higher strata. The level
  * of a frame is automatically set to the maximum level inside the strata
  * when the frame is clicked, which effectively brings the frame to the
- * front.
+ * front. Frames with a complex but mostly static content can also be
+ * rendered into a cached bitmap (see set_render_cached()).
  *
  * __Children and layered regions.__ See the @ref region documentation for
  * details about parent-child relationships. Note that, when reading from
@@ -253,6 +262,8 @@ using script_list_view = script_signal::slot_list_view;
  * child frames, and all the layered regions of the virtual frame.
  */
 class frame : public region {
+    friend animation_group;
+
 public:
     using base = region;
 
@@ -264,8 +275,10 @@ public:
      *  - iterators can be invalidated on removal
      *  - most common use is iteration, not addition or removal
      *  - ordering of elements is irrelevant
+     * \note Elements are allocated from the manager's memory arena.
      */
-    using child_list      = std::list<utils::owner_ptr<frame>>;
+    using child_list =
+        std::list<utils::owner_ptr<frame>, utils::arena_allocator<utils::owner_ptr<frame>>>;
     using child_list_view = utils::view::
         adaptor<child_list, utils::view::smart_ptr_dereferencer, utils::view::non_null_filter>;
     using const_child_list_view = utils::view::adaptor<
@@ -281,8 +294,11 @@ public:
      *  - iterators can be invalidated on removal
      *  - most common use is iteration, not addition or removal
      *  - ordering of elements is irrelevant
+     * \note Elements are allocated from the manager's memory arena.
      */
-    using region_list      = std::list<utils::owner_ptr<layered_region>>;
+    using region_list = std::list<
+        utils::owner_ptr<layered_region>,
+        utils::arena_allocator<utils::owner_ptr<layered_region>>>;
     using region_list_view = utils::view::
         adaptor<region_list, utils::view::smart_ptr_dereferencer, utils::view::non_null_filter>;
     using const_region_list_view = utils::view::adaptor<
@@ -299,6 +315,24 @@ public:
     /// Renders this region on the current render target.
     void render() const override;
 
+    /**
+     * \brief Renders this region on the current render target, skipping what is out of view.
+     * \param clip_bounds The visible area, in the coordinates of the frame renderer
+     * \note If get_render_bounds() does not overlap the visible area, nothing is rendered.
+     * Otherwise, regions whose render bounds do not overlap the visible area are skipped.
+     * Nothing is skipped if the frame is transformed by an animation.
+     */
+    void render(const bounds2f& clip_bounds) const;
+
+    /**
+     * \brief Returns the bounds of what this frame renders.
+     * \return The bounds of this frame's borders and regions
+     * \note This does not include child frames, which are rendered separately. The bounds
+     * are cached, and computed again after notify_renderer_need_redraw() is called. They
+     * do not take animation transforms into account.
+     */
+    bounds2f get_render_bounds() const override;
+
     /**
      * \brief Updates this region's logic.
      * \param delta Time spent since last update
@@ -865,8 +899,10 @@ public:
     }
 
     /**
-     * \brief Calculates effective scale.
+     * \brief Returns this frame's effective scale.
      * \return Effective scale (scale*parent->scale)
+     * \note This value is cached, and updated whenever the scale of this frame or of one
+     * of its parents changes.
      */
     float get_effective_scale() const;
 
@@ -1371,6 +1407,115 @@ public:
      */
     float get_update_rate() const;
 
+    /**
+     * \brief Creates a new animation group owned by this frame.
+     * \param name The name of the group
+     * \return The new animation group
+     * \note If a group with the same name already exists, it is stopped and replaced.
+     */
+    animation_group& add_animation_group(const std::string& name);
+
+    /**
+     * \brief Returns one of this frame's animation groups.
+     * \param name The name of the group
+     * \return The animation group, or nullptr if not found
+     */
+    animation_group* get_animation_group(const std::string& name);
+
+    /**
+     * \brief Returns one of this frame's animation groups.
+     * \param name The name of the group
+     * \return The animation group, or nullptr if not found
+     */
+    const animation_group* get_animation_group(const std::string& name) const;
+
+    /**
+     * \brief Starts playing one of this frame's animation groups, from the beginning.
+     * \param name The name of the group
+     */
+    void play_animation(const std::string& name);
+
+    /**
+     * \brief Stops playing one of this frame's animation groups.
+     * \param name The name of the group
+     * \note This does not trigger the `OnAnimationFinished` script.
+     */
+    void stop_animation(const std::string& name);
+
+    /**
+     * \brief Checks if one of this frame's animation groups is playing.
+     * \param name The name of the group
+     * \return 'true' if the group is playing
+     */
+    bool is_animation_playing(const std::string& name) const;
+
+    /**
+     * \brief Checks if any of this frame's animation groups is playing.
+     * \return 'true' if at least one group is playing
+     */
+    bool is_animation_playing() const;
+
+    /**
+     * \brief Advances all playing animation groups in time.
+     * \param delta The time elapsed since the last update (in seconds)
+     * \note This is called automatically by the root, for frames with playing
+     * animation groups. Triggers the `OnAnimationFinished` script for each group
+     * which finishes. Triggered callbacks could destroy the frame. If you need
+     * to use the frame again after calling this function, use the helper class
+     * alive_checker.
+     */
+    void update_animations(float delta);
+
+    /**
+     * \brief Checks if this frame is rendered with an animation transform.
+     * \return 'true' if this frame, or one of its parents, is translated, scaled,
+     * or rotated by an animation
+     */
+    bool is_animation_transformed() const;
+
+    /**
+     * \brief Returns the transform applied by animations when rendering this frame.
+     * \return The transform, including the transforms of this frame's parents
+     * \note This does not affect the borders of the frame, nor mouse hit tests.
+     */
+    matrix4f get_animation_transform() const;
+
+    /**
+     * \brief Enables or disables rendering this frame into a cached bitmap.
+     * \param cached 'true' to enable caching, 'false' to disable it
+     * \details When enabled, this frame, its regions, and all its children are rendered
+     * into a render target of the size of this frame, which is then drawn as a single quad.
+     * The render target is only rendered again when this frame or one of its children
+     * needs to be redrawn (see notify_renderer_need_redraw()). Other changes in the same
+     * strata then only need to draw this quad, rather than the whole content of the frame.
+     * \note Only the content within the borders of this frame is rendered. Children are
+     * rendered in order of strata and level, but all of them appear at the strata and level
+     * of this frame. The animation transform of this frame applies to the cached bitmap.
+     * Mouse inputs are not affected.
+     */
+    void set_render_cached(bool cached);
+
+    /**
+     * \brief Checks if this frame is rendered into a cached bitmap.
+     * \return 'true' if this frame is rendered into a cached bitmap
+     * \note See set_render_cached().
+     */
+    bool is_render_cached() const;
+
+    /**
+     * \brief Checks if this frame is rendered in the cached bitmap of one of its parents.
+     * \return 'true' if this frame is rendered in the cached bitmap of one of its parents
+     * \note Such frames are not rendered by their frame renderer, see set_render_cached().
+     */
+    bool is_in_render_cache() const;
+
+    /**
+     * \brief Renders this frame into its cached bitmap, if it needs to be redrawn.
+     * \note This is called automatically by the root, for frames rendered into a cached
+     * bitmap (see set_render_cached()). This must not be called while rendering.
+     */
+    void update_render_cache();
+
     /**
      * \brief Tells this frame to react to a certain event.
      * \param event_name The name of the event
@@ -1740,6 +1885,7 @@ protected:
     virtual void parse_layers_node_(const layout_node& node);
     virtual void parse_frames_node_(const layout_node& node);
     virtual void parse_scripts_node_(const layout_node& node);
+    virtual void parse_animations_node_(const layout_node& node);
 
     const std::vector<std::string>& get_type_list_() const override;
 
@@ -1749,6 +1895,31 @@ protected:
     utils::observer_ptr<frame> parse_child_(const layout_node& node, const std::string& type);
 
     virtual void update_(float delta);
+    void         render_(const bounds2f* clip_bounds) const;
+
+    /**
+     * \brief Renders the layered regions of this frame.
+     * \param clip_bounds The area to render, or nullptr to render everything
+     * \note This is called by render_(), after the backdrop, with the animation transform
+     * already applied to the view. The default implementation calls render_layers_() for
+     * all layers. This can be overridden to render other content between layers.
+     */
+    virtual void render_layered_regions_(const bounds2f* clip_bounds) const;
+
+    /**
+     * \brief Renders the layered regions of this frame within a range of layers.
+     * \param first The first layer to render
+     * \param last The last layer to render (included)
+     * \param clip_bounds The area to render, or nullptr to render everything
+     */
+    void render_layers_(layer first, layer last, const bounds2f* clip_bounds) const;
+
+    /**
+     * \brief Returns the animation transform to apply when rendering this frame.
+     * \return The animation transform, relative to the cached bitmap being rendered, if any
+     * \note See get_animation_transform() and set_render_cached().
+     */
+    matrix4f get_render_transform_() const;
 
     void check_position_();
 
@@ -1767,7 +1938,27 @@ protected:
 
     void notify_frame_renderer_changed_(const utils::observer_ptr<frame_renderer>& new_renderer);
 
-    void update_borders_() override;
+    void notify_borders_updated_(const bounds2f& old_border_list, bool old_valid) override;
+
+    void notify_effective_alpha_changed_() override;
+    void update_effective_scale_();
+
+    void set_animation_transform_(
+        const animation_group& group,
+        const vector2f&        offset,
+        const vector2f&        scale,
+        float                  rotation);
+    void reset_animation_transform_(const animation_group& group);
+    void update_animation_transform_();
+    void update_animation_transformed_();
+    void notify_animation_started_();
+
+    matrix4f compute_animation_transform_(const frame* stop_frame) const;
+
+    void         update_render_cache_owner_();
+    const frame* get_active_render_cache_() const;
+    void         render_cached_or_direct_(const bounds2f* clip_bounds) const;
+    void         blit_render_cache_(const bounds2f* clip_bounds) const;
 
     /**
      * \brief Changes this region's parent.
@@ -1805,8 +1996,15 @@ protected:
 
     std::array<layer_container, num_layers> layer_list_;
 
-    std::unordered_map<std::string, script_signal> signal_list_;
-    event_receiver                                 event_receiver_;
+    using signal_map = std::unordered_map<
+        std::string,
+        script_signal,
+        std::hash<std::string>,
+        std::equal_to<std::string>,
+        utils::arena_allocator<std::pair<const std::string, script_signal>>>;
+
+    signal_map     signal_list_;
+    event_receiver event_receiver_;
 
     std::set<std::string> reg_drag_list_;
     std::set<std::string> reg_key_list_;
@@ -1838,7 +2036,8 @@ protected:
     float min_height_ = 0.0f;
     float max_height_ = std::numeric_limits<float>::infinity();
 
-    float scale_ = 1.0f;
+    float scale_           = 1.0f;
+    float effective_scale_ = 1.0f;
 
     float update_rate_            = 0.0f;
     float time_since_last_update_ = std::numeric_limits<float>::infinity();
@@ -1849,6 +2048,33 @@ protected:
 
     bool is_focused_    = false;
     bool is_auto_focus_ = false;
+
+    std::vector<std::unique_ptr<animation_group>> animation_group_list_;
+
+    struct animation_transform {
+        const animation_group* group    = nullptr;
+        vector2f               offset   = vector2f::zero;
+        vector2f               scale    = vector2f(1.0f, 1.0f);
+        float                  rotation = 0.0f;
+    };
+
+    std::vector<animation_transform> animation_transform_list_;
+
+    vector2f animation_offset_         = vector2f::zero;
+    vector2f animation_scale_          = vector2f(1.0f, 1.0f);
+    float    animation_rotation_       = 0.0f;
+    bool     has_animation_transform_  = false;
+    bool     is_animation_transformed_ = false;
+
+    mutable bounds2f render_bounds_          = bounds2f::zero;
+    mutable bool     is_render_bounds_dirty_ = true;
+
+    bool                           is_render_cached_      = false;
+    bool                           is_render_cache_dirty_ = true;
+    bool                           is_rendering_cache_    = false;
+    utils::observer_ptr<frame>     render_cache_owner_    = nullptr;
+    std::shared_ptr<render_target> render_cache_target_;
+    quad                           render_cache_quad_;
 };
 
 } // namespace lxgui::gui
@@ -1,6 +1,7 @@
 #ifndef LXGUI_GUI_FRAME_RENDERER_HPP
 #define LXGUI_GUI_FRAME_RENDERER_HPP
 
+#include "lxgui/gui_bounds2.hpp"
 #include "lxgui/gui_strata.hpp"
 #include "lxgui/lxgui.hpp"
 #include "lxgui/utils.hpp"
@@ -65,6 +66,14 @@ public:
      */
     virtual vector2f get_target_dimensions() const = 0;
 
+    /**
+     * \brief Returns the offset between rendered frames and their on-screen position.
+     * \return The offset to add to the borders of a rendered frame to get its on-screen position
+     * \note This is zero unless frames are rendered with a view transform, see
+     * scroll_frame::set_translation_scroll_enabled().
+     */
+    virtual vector2f get_render_offset() const;
+
     /**
      * \brief Find the top-most frame matching the provided predicate
      * \param predicate A function returning 'true' if the frame can be selected
@@ -96,7 +105,11 @@ protected:
     bool has_strata_list_changed_() const;
     void reset_strata_list_changed_flag_();
 
+    utils::observer_ptr<const frame> find_topmost_frame_(
+        const std::function<bool(const frame&)>& predicate, const bounds2f& clip_bounds) const;
+
     void render_strata_(const strata_data& strata_obj) const;
+    void render_strata_(const strata_data& strata_obj, const bounds2f& clip_bounds) const;
 
     struct frame_comparator {
         bool operator()(const frame* f1, const frame* f2) const;
@@ -0,0 +1,201 @@
+#ifndef LXGUI_GUI_LIST_VIEW_HPP
+#define LXGUI_GUI_LIST_VIEW_HPP
+
+#include "lxgui/gui_scroll_frame.hpp"
+#include "lxgui/lxgui.hpp"
+#include "lxgui/utils.hpp"
+
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace lxgui::gui {
+
+/**
+ * \brief A #scroll_frame displaying a long list of rows.
+ * \details The rows all share the same layout, defined by a "row template" (a list of
+ * virtual frames to inherit from), and the same height. The content of each row is
+ * filled by a "row binder" function, which receives the row frame and the index of the
+ * row to display.
+ *
+ * Only the rows that are visible are actually created: when scrolling, rows which move
+ * out of view are recycled to display the rows that move into view, and the row binder is
+ * called again to update their content. The number of frames (and the cost of updating
+ * them) therefore depends on the size of the list_view, and not on the number of rows.
+ * Because of this, rows should not store any state that is not set by the row binder.
+ *
+ * The scroll child is created and managed by the list_view, and must not be changed.
+ * Translation-only scrolling is enabled by default (see
+ * scroll_frame::set_translation_scroll_enabled()).
+ *
+ * By default, the mouse wheel movement will not trigger any scrolling;
+ * this has to be explicitly implemented using the `OnMouseWheel` callback
+ * and the scroll_frame::set_vertical_scroll function.
+ */
+class list_view : public scroll_frame {
+public:
+    using base = scroll_frame;
+
+    /**
+     * \brief Function called to display a row.
+     * \details The arguments are the list_view, the row frame, and the index of the row
+     * to display (starting at zero).
+     */
+    using row_binder = std::function<void(list_view&, frame&, std::size_t)>;
+
+    /// Value returned by get_row_index() for rows which are not displayed.
+    static constexpr std::size_t no_row = std::numeric_limits<std::size_t>::max();
+
+    /// Constructor.
+    explicit list_view(
+        utils::control_block& block, manager& mgr, const frame_core_attributes& attr);
+
+    /**
+     * \brief Prints all relevant information about this region in a string.
+     * \param tab The offset to give to all lines
+     * \return All relevant information about this region
+     */
+    std::string serialize(const std::string& tab) const override;
+
+    /**
+     * \brief Copies a region's parameters into this list_view (inheritance).
+     * \param obj The region to copy
+     */
+    void copy_from(const region& obj) override;
+
+    /**
+     * \brief Calls a script.
+     * \param script_name The name of the script
+     * \param data Stores scripts arguments
+     * \note Triggered callbacks could destroy the frame. If you need
+     * to use the frame again after calling this function, use
+     * the helper class alive_checker.
+     */
+    void
+    fire_script(const std::string& script_name, const event_data& data = event_data{}) override;
+
+    /// Notifies this region that it has been fully loaded.
+    void notify_loaded() override;
+
+    /**
+     * \brief Sets the virtual frames to inherit from when creating rows.
+     * \param inheritance The names of the virtual frames, separated by commas
+     * \note The type of the row frames is the type of the first virtual frame in the list.
+     * Existing rows are destroyed and re-created.
+     */
+    void set_row_template(const std::string& inheritance);
+
+    /**
+     * \brief Returns the virtual frames to inherit from when creating rows.
+     * \return The names of the virtual frames, separated by commas
+     */
+    const std::string& get_row_template() const;
+
+    /**
+     * \brief Sets the number of rows in the list.
+     * \param row_count The number of rows
+     * \note This calls refresh_rows().
+     */
+    void set_row_count(std::size_t row_count);
+
+    /**
+     * \brief Returns the number of rows in the list.
+     * \return The number of rows in the list
+     */
+    std::size_t get_row_count() const;
+
+    /**
+     * \brief Sets the height of each row.
+     * \param row_height The height of each row
+     * \note If zero (the default), the height defined by the row template is used.
+     */
+    void set_row_height(float row_height);
+
+    /**
+     * \brief Returns the height of each row.
+     * \return The height of each row
+     * \note If no row height was specified, and no row was created yet, this returns zero.
+     */
+    float get_row_height() const;
+
+    /**
+     * \brief Sets the number of extra rows to create above and below the visible rows.
+     * \param overscan The number of extra rows
+     * \note Extra rows are displayed before they are needed, which avoids calling the
+     * row binder when scrolling by small amounts back and forth.
+     */
+    void set_overscan(std::size_t overscan);
+
+    /**
+     * \brief Returns the number of extra rows created above and below the visible rows.
+     * \return The number of extra rows
+     */
+    std::size_t get_overscan() const;
+
+    /**
+     * \brief Sets the function called to display a row.
+     * \param binder The function
+     * \note This calls refresh_rows().
+     */
+    void set_row_binder(row_binder binder);
+
+    /**
+     * \brief Calls the row binder again for all displayed rows.
+     * \note Call this when the data displayed in the list has changed.
+     */
+    void refresh_rows();
+
+    /**
+     * \brief Returns the frame currently displaying a row.
+     * \param row_index The index of the row (starting at zero)
+     * \return The frame displaying this row, or nullptr if the row is not displayed
+     */
+    utils::observer_ptr<frame> get_row_frame(std::size_t row_index);
+
+    /**
+     * \brief Returns the index of the row displayed by a frame.
+     * \param row_frame A row frame of this list_view
+     * \return The index of the row displayed by this frame, or no_row if none
+     */
+    std::size_t get_row_index(const frame& row_frame) const;
+
+    /// Registers this region class to the provided Lua state
+    static void register_on_lua(sol::state& lua);
+
+    static constexpr const char* class_name = "ListView";
+
+protected:
+    void parse_attributes_(const layout_node& node) override;
+
+    const std::vector<std::string>& get_type_list_() const override;
+
+    void create_content_();
+    void clear_rows_();
+    void update_content_size_();
+
+    utils::observer_ptr<frame> create_row_(std::size_t slot);
+
+    void update_rows_(bool rebind_all);
+    void bind_row_(std::size_t slot, std::size_t row_index);
+
+    std::string row_template_;
+    std::size_t row_count_  = 0u;
+    float       row_height_ = 0.0f;
+    std::size_t overscan_   = 2u;
+    row_binder  row_binder_;
+
+    utils::observer_ptr<frame> content_ = nullptr;
+
+    struct row_slot {
+        utils::observer_ptr<frame> row_frame = nullptr;
+        std::size_t                row_index = no_row;
+    };
+
+    /// Row frames; the row with index i is displayed by slot (i % size).
+    std::vector<row_slot> row_slot_list_;
+    float                 template_row_height_ = 0.0f;
+};
+
+} // namespace lxgui::gui
+
+#endif
@@ -3,7 +3,9 @@
 
 #include "lxgui/gui_code_point_range.hpp"
 #include "lxgui/lxgui.hpp"
+#include "lxgui/utils_variant.hpp"
 
+#include <iterator>
 #include <locale>
 #include <lxgui/extern_fmt.hpp>
 #include <lxgui/extern_sol2_state.hpp>
@@ -169,6 +171,25 @@ public:
      */
     void load_translation_file(const std::string& file_name);
 
+    /**
+     * \brief Sets the maximum number of translations remembered by localize().
+     * \param size The maximum number of remembered translations (0 to disable)
+     * \details When enabled, localize() will remember the result of translations called from Lua
+     * with a given set of input arguments. If the same translation is requested again with
+     * the same arguments, the remembered string is returned without formatting. This is
+     * useful when the same strings are localized repeatedly (e.g., each frame). Translations
+     * defined with a Lua function are never remembered. The default is 0 (disabled).
+     * \note Changing the size of the cache clears all previously remembered translations.
+     */
+    void set_translation_cache_size(std::size_t size);
+
+    /**
+     * \brief Returns the maximum number of translations remembered by localize().
+     * \return The maximum number of translations remembered by localize()
+     * \see set_translation_cache_size()
+     */
+    std::size_t get_translation_cache_size() const;
+
     /**
      * \brief Removes all previously loaded translations.
      * \note After calling this function, it is highly recommended to always include at least
@@ -232,14 +253,9 @@ public:
         return std::visit(
             [&](const auto& item) {
                 constexpr bool is_string =
-                    std::is_same_v<std::decay_t<decltype(item)>, std::string>;
+                    std::is_same_v<std::decay_t<decltype(item)>, format_template>;
                 if constexpr (is_string) {
-                    if constexpr (sizeof...(Args) == 0) {
-                        return item;
-                    } else {
-                        return fmt::format(
-                            locale_, fmt::runtime(item), std::forward<Args>(args)...);
-                    }
+                    return apply_template_(item, args...);
                 } else {
                     auto result = item(std::forward<Args>(args)...);
                     if (result.valid() && result.begin() != result.end()) {
@@ -252,7 +268,7 @@ public:
                         return std::string{key};
                 }
             },
-            iter->second);
+            iter->second.item);
     }
 
     /**
@@ -264,9 +280,40 @@ public:
     void register_on_lua(sol::state& lua);
 
 private:
+    /// Pre-parsed format string, see compile_template_().
+    struct format_template {
+        static constexpr std::size_t no_arg = static_cast<std::size_t>(-1);
+
+        /// Appends a piece of literal text, followed by an optional argument.
+        struct op {
+            std::size_t literal_offset = 0;
+            std::size_t literal_size   = 0;
+            std::size_t arg_index      = no_arg;
+            std::string format; // "{:spec}", or empty if no format specification
+        };
+
+        std::string     source;
+        std::string     text; // Literal text with escaped braces resolved
+        std::vector<op> ops;
+        std::size_t     arg_count   = 0;
+        bool            is_compiled = false;
+    };
+
     using hash_type   = std::size_t;
-    using mapped_item = std::variant<std::string, sol::protected_function>;
-    using map_type    = std::unordered_map<hash_type, mapped_item>;
+    using mapped_item = std::variant<format_template, sol::protected_function>;
+
+    struct translation {
+        std::string key;
+        mapped_item item;
+    };
+
+    using map_type = std::unordered_multimap<hash_type, translation>;
+
+    struct cache_entry {
+        const format_template*     tmpl = nullptr;
+        std::vector<utils::variant> args;
+        std::string                result;
+    };
 
     std::locale                   locale_;
     std::vector<std::string>      languages_;
@@ -275,9 +322,58 @@ private:
     sol::state                    lua_;
     map_type                      map_;
 
+    mutable std::vector<cache_entry> cache_;
+
     bool                     is_key_valid_(std::string_view key) const;
     map_type::const_iterator find_key_(std::string_view key) const;
     void                     reset_language_fallback_();
+
+    static format_template compile_template_(std::string message);
+
+    std::string apply_template_variants_(
+        const format_template& tmpl, const std::vector<utils::variant>& args) const;
+
+    template<typename T>
+    void append_argument_(std::string& output, const std::string& format, const T& value) const {
+        if (format.empty()) {
+            if constexpr (std::is_convertible_v<const T&, std::string_view>)
+                output.append(std::string_view(value));
+            else
+                fmt::format_to(std::back_inserter(output), "{}", value);
+        } else {
+            output += fmt::format(locale_, fmt::runtime(format), value);
+        }
+    }
+
+    template<typename... Args>
+    std::string apply_template_(const format_template& tmpl, const Args&... args) const {
+        if (!tmpl.is_compiled || tmpl.arg_count > sizeof...(Args)) {
+            // Let fmtlib handle the format string and report errors
+            if constexpr (sizeof...(Args) == 0)
+                return tmpl.source;
+            else
+                return fmt::format(locale_, fmt::runtime(tmpl.source), args...);
+        }
+
+        if (tmpl.arg_count == 0)
+            return tmpl.text;
+
+        std::string output;
+        output.reserve(tmpl.text.size());
+        for (const auto& op : tmpl.ops) {
+            output.append(tmpl.text, op.literal_offset, op.literal_size);
+            if constexpr (sizeof...(Args) != 0) {
+                if (op.arg_index == format_template::no_arg)
+                    continue;
+
+                std::size_t index = 0;
+                ((index++ == op.arg_index ? append_argument_(output, op.format, args) : void()),
+                 ...);
+            }
+        }
+
+        return output;
+    }
 };
 
 } // namespace lxgui::gui
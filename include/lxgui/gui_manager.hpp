@@ -3,6 +3,7 @@
 
 #include "lxgui/input_keys.hpp"
 #include "lxgui/lxgui.hpp"
+#include "lxgui/utils_memory_pool.hpp"
 #include "lxgui/utils_observer.hpp"
 #include "lxgui/utils_signal.hpp"
 
@@ -202,6 +203,52 @@ public:
      */
     void reload_ui_now();
 
+    /**
+     * \brief Enables or disables fast UI re-loading.
+     * \param enabled 'true' to enable, 'false' to disable
+     * \note Disabled by default. When enabled, reload_ui_now() keeps the renderer's
+     * materials, fonts, and atlases alive while the UI is re-loaded, so that they
+     * do not need to be loaded again from disk; resources that are no longer used
+     * after the re-load are released. The Lua state is also preserved: it is reset
+     * to a snapshot taken after all the built-in types and functions were
+     * registered, rather than created again from scratch. Since the Lua state is
+     * not re-created, on_create_lua is not triggered on a fast re-load.
+     * \note Because textures are not re-loaded, changes made to texture files on disk
+     * will not be visible after a fast re-load.
+     * \note Changing this flag takes effect on the next call to load_ui() or
+     * reload_ui_now().
+     */
+    void set_fast_reload_enabled(bool enabled);
+
+    /**
+     * \brief Checks if fast UI re-loading is enabled.
+     * \return 'true' if fast UI re-loading is enabled
+     * \see set_fast_reload_enabled()
+     */
+    bool is_fast_reload_enabled() const;
+
+    /**
+     * \brief Re-loads a single addon safely (at the end of update_ui()).
+     * \param addon_name The name of the addon (name of its directory)
+     * \note The actual re-loading will be deferred until the end of update_ui(),
+     * therefore it is safe to call this function at any time. If you need to
+     * reload the addon without delay, use reload_addon_now().
+     */
+    void reload_addon(const std::string& addon_name);
+
+    /**
+     * \brief Re-loads a single addon (immediately).
+     * \param addon_name The name of the addon (name of its directory)
+     * \note All the frames created by this addon are destroyed, then the addon files
+     * are loaded again. The rest of the UI is left untouched. The addon's saved
+     * variables are saved before the re-load, and read again after. If fast
+     * re-loading is enabled (see set_fast_reload_enabled()), the renderer
+     * resources are preserved across the re-load.
+     * \warning Do not call this function while the manager is running update_ui()
+     * (i.e., do not call this directly from a frame's callback, C++ or Lua).
+     */
+    void reload_addon_now(const std::string& addon_name);
+
     /**
      * \brief Checks if the UI has been loaded.
      * \return 'true' if the UI has being loaded
@@ -217,6 +264,8 @@ public:
     /**
      * \brief Updates this manager and its regions.
      * \param delta The time elapsed since the last call
+     * \note If the input dispatcher is in buffered mode (see input::dispatcher::set_buffered()),
+     * this is also where queued input events are forwarded to the UI.
      */
     void update_ui(float delta);
 
@@ -360,6 +409,24 @@ public:
         return *virtual_root_;
     }
 
+    /**
+     * \brief Returns the memory arena used to allocate internal UI data.
+     * \return The memory arena
+     * \note The memory held by the arena is kept when the UI is re-loaded, and
+     * returned to the system when the UI is closed.
+     */
+    utils::memory_arena& get_memory_arena() {
+        return memory_arena_;
+    }
+
+    /**
+     * \brief Returns the memory arena used to allocate internal UI data.
+     * \return The memory arena
+     */
+    const utils::memory_arena& get_memory_arena() const {
+        return memory_arena_;
+    }
+
     /**
      * \brief Returns the UI object factory, which is used to create new objects.
      * \return The factory object
@@ -401,6 +468,26 @@ private:
      */
     void create_lua_();
 
+    /**
+     * \brief Saves the current content of the Lua state as the base state.
+     * \note See restore_lua_snapshot_().
+     */
+    void take_lua_snapshot_();
+
+    /**
+     * \brief Resets the Lua state to the base state saved by take_lua_snapshot_().
+     * \note All global variables created since the snapshot are removed, and
+     * all global variables (and the content of global tables) that existed
+     * at the time of the snapshot are restored.
+     */
+    void restore_lua_snapshot_();
+
+    /**
+     * \brief Closes the UI (immediately).
+     * \param keep_lua 'true' to keep the Lua state alive, if a snapshot is available
+     */
+    void close_ui_(bool keep_lua);
+
     /**
      * \brief Reads GUI files in the directory list.
      * \note See add_addon_directory().
@@ -415,6 +502,7 @@ private:
     float                    scaling_factor_      = 1.0f;
     float                    base_scaling_factor_ = 1.0f;
     bool                     enable_caching_      = false;
+    bool                     fast_reload_enabled_ = false;
     std::vector<std::string> localization_directory_list_;
     std::vector<std::string> gui_directory_list_;
 
@@ -429,6 +517,7 @@ private:
     std::unique_ptr<event_emitter>           event_emitter_;
 
     // UI state
+    utils::memory_arena             memory_arena_;
     std::unique_ptr<factory>        factory_;
     std::unique_ptr<localizer>      localizer_;
     std::unique_ptr<sol::state>     lua_;
@@ -440,6 +529,9 @@ private:
     bool reload_ui_flag_     = false;
     bool close_ui_flag_      = false;
     bool is_first_iteration_ = true;
+    bool has_lua_snapshot_   = false;
+
+    std::vector<std::string> reload_addon_list_;
 };
 
 } // namespace lxgui::gui
@@ -38,6 +38,8 @@ class layout_node;
 
 class frame;
 class frame_renderer;
+class root;
+class animation_group;
 
 /**
  * \brief The base class of all elements in the GUI.
@@ -161,6 +163,8 @@ class frame_renderer;
 class region : public utils::enable_observer_from_this<region> {
     friend factory;
     friend frame;
+    friend root;
+    friend animation_group;
 
 public:
     /// Contructor.
@@ -268,7 +272,9 @@ public:
     /**
      * \brief Returns this region's effective alpha (opacity).
      * \return This region's effective alpha (opacity).
-     * \note This includes the region's parent alpha.
+     * \note This includes the region's parent alpha, and the effect of animations. This
+     * value is cached, and updated whenever the alpha of this region or of one of its
+     * parents changes.
      */
     float get_effective_alpha() const;
 
@@ -397,11 +403,20 @@ public:
 
     /**
      * \brief Checks if the provided coordinates are inside this region.
-     * \param position The coordinates to test
+     * \param position The coordinates to test, on screen
      * \return 'true' if the provided coordinates are inside this region
      */
     virtual bool is_in_region(const vector2f& position) const;
 
+    /**
+     * \brief Converts a position on screen into the coordinates of this region's borders.
+     * \param position The position on screen
+     * \return The position in the same coordinates as get_borders()
+     * \note Both are identical, unless this region is rendered by a scroll_frame with
+     * translation-only scrolling (see frame_renderer::get_render_offset()).
+     */
+    vector2f to_local_position(const vector2f& position) const;
+
     /**
      * \brief Returns the type of this region.
      * \return The type of this region
@@ -468,6 +483,15 @@ public:
      */
     const bounds2f& get_borders() const;
 
+    /**
+     * \brief Returns the bounds of what this region renders.
+     * \return The bounds of what this region renders
+     * \note This is the same as get_borders() for most regions, but can be larger for
+     * regions which render outside of their borders (e.g., text overflowing a font_string).
+     * This is used to skip rendering regions which are out of view.
+     */
+    virtual bounds2f get_render_bounds() const;
+
     /**
      * \brief Removes all anchors.
      * \note This region and its children won't be visible until you
@@ -747,13 +771,59 @@ protected:
     parse_dimension_node_(const layout_node& node);
 
     void read_anchors_(
-        float& left, float& right, float& top, float& bottom, float& x_center, float& y_center)
-        const;
+        float&          left,
+        float&          right,
+        float&          top,
+        float&          bottom,
+        float&          x_center,
+        float&          y_center,
+        const vector2f& target_dimensions) const;
 
     bool make_borders_(float& min, float& max, float center, float size) const;
 
+    /**
+     * \brief Computes the borders of this region from its anchors and dimensions.
+     * \param target_dimensions The dimensions of the render target of this region
+     * \note This only updates the borders, and does not notify anyone. Provided that
+     * the regions this region is anchored to are up to date, this can be called from a
+     * worker thread (see root::set_layout_thread_count()).
+     */
+    void compute_borders_(const vector2f& target_dimensions);
+
+    /**
+     * \brief Updates the borders of this region, and notifies of the change.
+     * \note Derived classes should override notify_borders_updated_() instead. If they
+     * override this function, they must also override can_compute_borders_in_parallel_().
+     */
     virtual void update_borders_();
 
+    /**
+     * \brief Called after the borders have been updated.
+     * \param old_border_list The borders before the update
+     * \param old_valid The validity of the borders before the update
+     * \note This is always called on the main thread.
+     */
+    virtual void notify_borders_updated_(const bounds2f& old_border_list, bool old_valid);
+
+    /**
+     * \brief Checks if update_borders_() can be split in two steps.
+     * \return 'true' if update_borders_() is equivalent to compute_borders_() followed by
+     * notify_borders_updated_(), 'false' otherwise
+     * \note When 'true', compute_borders_() may be called from a worker thread.
+     */
+    virtual bool can_compute_borders_in_parallel_() const;
+
+    void resolve_pending_layout_() const;
+    void notify_anchors_changed_();
+
+    void update_effective_alpha_();
+    void set_animation_alpha_(const animation_group& group, float alpha);
+    void reset_animation_alpha_(const animation_group& group);
+    void update_animation_alpha_();
+
+    /// Called when the effective alpha of this region has changed.
+    virtual void notify_effective_alpha_changed_();
+
     sol::state&       get_lua_();
     const sol::state& get_lua_() const;
 
@@ -806,18 +876,25 @@ protected:
 
     utils::observer_ptr<frame> parent_ = nullptr;
 
-    bool is_manually_inherited_ = false;
-    bool is_virtual_            = false;
-    bool is_loaded_             = false;
-    bool is_valid_              = true;
+    bool is_manually_inherited_    = false;
+    bool is_virtual_               = false;
+    bool is_loaded_                = false;
+    bool is_valid_                 = true;
+    bool is_borders_update_queued_ = false;
 
     std::array<std::optional<anchor>, 9> anchor_list_;
     bounds2<bool>                        defined_borders_;
     bounds2f                             borders_;
 
-    float alpha_      = 1.0f;
-    bool  is_shown_   = true;
-    bool  is_visible_ = true;
+    float alpha_           = 1.0f;
+    float animation_alpha_ = 1.0f;
+    float effective_alpha_ = 1.0f;
+    bool  is_shown_        = true;
+    bool  is_visible_      = true;
+
+    // Alpha factor of each animation group animating this region; animation_alpha_ is
+    // their product
+    std::vector<std::pair<const animation_group*, float>> animation_alpha_list_;
 
     vector2f dimensions_;
 
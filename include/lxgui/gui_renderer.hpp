@@ -1,9 +1,11 @@
 #ifndef LXGUI_GUI_RENDERER_HPP
 #define LXGUI_GUI_RENDERER_HPP
 
+#include "lxgui/gui_bounds2.hpp"
 #include "lxgui/gui_code_point_range.hpp"
 #include "lxgui/gui_material.hpp"
 #include "lxgui/gui_matrix4.hpp"
+#include "lxgui/gui_text_layout.hpp"
 #include "lxgui/gui_vertex_cache.hpp"
 #include "lxgui/lxgui.hpp"
 
@@ -18,6 +20,7 @@ namespace lxgui::gui {
 class font;
 class atlas;
 class render_target;
+class texture_file;
 class color;
 struct quad;
 struct vertex;
@@ -55,6 +58,14 @@ public:
      */
     virtual bool is_texture_vertex_color_supported() const = 0;
 
+    /**
+     * \brief Checks if the renderer supports repeating a texture within a region of the texture.
+     * \return 'true' if supported, 'false' otherwise
+     * \note See render_tiled_quads(). Returns 'false' by default. Renderers supporting this
+     * must also support scissors, since tiled quads cannot be clipped by the CPU.
+     */
+    virtual bool is_quad_tiling_supported() const;
+
     /**
      * \brief Checks if the renderer has quad render batching enabled.
      * \return 'true' if enabled, 'false' otherwise
@@ -74,6 +85,34 @@ public:
      */
     void set_quad_batching_enabled(bool enabled);
 
+    /**
+     * \brief Returns the maximum number of textures that a single quad batch can use.
+     * \return The maximum number of textures that a single quad batch can use
+     * \note If larger than one, the renderer supports multi-texture batching, see
+     * set_multi_texture_batching_enabled(). Returns one by default.
+     */
+    virtual std::size_t get_batch_texture_slot_count() const;
+
+    /**
+     * \brief Checks if the renderer has multi-texture batching enabled.
+     * \return 'true' if enabled and supported, 'false' otherwise
+     */
+    bool is_multi_texture_batching_enabled() const;
+
+    /**
+     * \brief Enables/disables multi-texture batching.
+     * \param enabled 'true' to enable multi-texture batching, 'false' to disable it
+     * \note Multi-texture batching is disabled by default, and only has an effect if quad
+     * batching is enabled and the renderer supports it (see get_batch_texture_slot_count()).
+     * \note With quad batching alone, a batch is rendered each time the texture changes.
+     * With multi-texture batching, a batch can use several textures (for example, several
+     * atlas pages, or an atlas page and a render target), and is only rendered when it
+     * uses more textures than the renderer can sample from in a single draw call. This
+     * means the size of atlas pages can be chosen to limit memory usage, rather than to
+     * maximize batching.
+     */
+    void set_multi_texture_batching_enabled(bool enabled);
+
     /**
      * \brief Returns the maximum texture width/height (in pixels).
      * \return The maximum texture width/height (in pixels)
@@ -151,12 +190,22 @@ public:
      */
     void set_vertex_cache_enabled(bool enabled);
 
+    /**
+     * \brief Checks if the renderer streams batched quads to the GPU directly.
+     * \return 'true' if quads are streamed, 'false' otherwise
+     * \note If 'true', quad batches are always rendered with render_quads_(), even if vertex
+     * caches are enabled, since the implementation already uploads vertices efficiently.
+     * Returns 'false' by default.
+     */
+    virtual bool is_quad_streaming_enabled() const;
+
     /// Automatically determines the best rendering settings for the current platform.
     void auto_detect_settings();
 
     /**
      * \brief Resets the number of batches to zero (for analytics only).
-     * \note See get_batch_count() and get_vertex_count().
+     * \note See get_batch_count(), get_vertex_count(), get_culled_frame_count(), and
+     * get_culled_region_count().
      * This should be called a the beginning of a frame.
      */
     void reset_counters();
@@ -173,6 +222,25 @@ public:
      */
     std::size_t get_vertex_count() const;
 
+    /**
+     * \brief Returns the number of frames skipped because they were out of view.
+     * \return The number of frames skipped since the last call to reset_counters
+     */
+    std::size_t get_culled_frame_count() const;
+
+    /**
+     * \brief Returns the number of regions skipped because they were out of view.
+     * \return The number of regions skipped since the last call to reset_counters
+     * \note This does not include the regions of culled frames.
+     */
+    std::size_t get_culled_region_count() const;
+
+    /// Tells the renderer that a frame was skipped because it was out of view (for analytics).
+    void notify_frame_culled();
+
+    /// Tells the renderer that a region was skipped because it was out of view (for analytics).
+    void notify_region_culled();
+
     /**
      * \brief Begins rendering on a particular render target.
      * \param target The render target (main screen if nullptr)
@@ -225,6 +293,35 @@ public:
      */
     virtual matrix4f get_view() const = 0;
 
+    /**
+     * \brief Checks if the renderer can clip rendering to a rectangle on the GPU.
+     * \return 'true' if clipping is done on the GPU, 'false' otherwise
+     * \note See push_clip_rect(). Returns 'false' by default.
+     */
+    virtual bool is_scissor_supported() const;
+
+    /**
+     * \brief Restricts rendering to a rectangle, until the matching call to pop_clip_rect().
+     * \param rect The clipping rectangle, in the coordinates of the current view
+     * \details Clipping rectangles can be nested; only the intersection of all the
+     * rectangles in the stack is rendered. The rectangle is converted into render target
+     * coordinates when pushed, so changing the view afterwards does not move it. If the
+     * view is rotated, the bounding box of the rotated rectangle is used.
+     *
+     * Clipping is done on the GPU, for all rendering operations. If is_scissor_supported()
+     * is 'false', the stack is still maintained but rendering is not clipped; callers
+     * which rely on clipping must check is_scissor_supported() first.
+     * \note This function is meant to be called between begin() and end() only. The
+     * stack is cleared at the end of each render pass.
+     */
+    void push_clip_rect(const bounds2f& rect);
+
+    /**
+     * \brief Restores the clipping rectangle active before the last call to push_clip_rect().
+     * \note This function is meant to be called between begin() and end() only.
+     */
+    void pop_clip_rect();
+
     /**
      * \brief Renders a quad.
      * \param q The quad to render on the current render target
@@ -244,6 +341,22 @@ public:
      */
     void render_quads(const material* mat, const std::vector<std::array<vertex, 4>>& quad_list);
 
+    /**
+     * \brief Renders a set of quads, repeating the texture within a region of the texture.
+     * \param mat The material to use for rendering
+     * \param quad_list The list of the quads you want to render
+     * \param tile_rect_list The region of the texture to repeat for each quad (in canvas UV)
+     * \note The texture coordinates of the quads are expressed in number of tiles: only
+     * their fractional part is used, and mapped inside the region. This allows tiling a
+     * texture stored in an atlas, which cannot rely on the texture wrapping mode. This
+     * function is meant to be called between begin() and end() only, and is only available
+     * if is_quad_tiling_supported() returns 'true'.
+     */
+    void render_tiled_quads(
+        const material*                           mat,
+        const std::vector<std::array<vertex, 4>>& quad_list,
+        const std::vector<bounds2f>&              tile_rect_list);
+
     /**
      * \brief Renders a vertex cache.
      * \param mat The material to use for rendering, or null if none
@@ -266,6 +379,13 @@ public:
         const vertex_cache& cache,
         const matrix4f&     model_transform = matrix4f::identity);
 
+    /**
+     * \brief Checks if the renderer supports raw texture files (.lxtex).
+     * \return 'true' if supported, 'false' otherwise
+     * \note See texture_file. Returns 'false' by default.
+     */
+    virtual bool is_texture_file_supported() const;
+
     /**
      * \brief Creates a new material from a texture file.
      * \param file_name The name of the file
@@ -273,6 +393,9 @@ public:
      * \return The new material
      * \note Supported texture formats are defined by implementation.
      * The gui library is completely unaware of this.
+     * \note If the renderer supports raw texture files (see is_texture_file_supported()),
+     * and a .lxtex file with the same name as the requested file exists and is at least as
+     * recent, the .lxtex file is loaded instead.
      */
     std::shared_ptr<material>
     create_material(const std::string& file_name, material::filter filt = material::filter::none);
@@ -304,6 +427,22 @@ public:
         const std::string& file_name,
         material::filter   filt = material::filter::none);
 
+    /**
+     * \brief Loads pre-packed atlas pages, produced offline by the `lxgui-atlas-bake` tool.
+     * \param atlas_category The category of atlas in which to load the pages
+     * \param manifest_file The manifest file describing the pages
+     * \param filt The filtering to apply to the pages
+     * \return 'true' if pages were loaded, 'false' otherwise
+     * \note The materials listed in the manifest are then returned by
+     * create_atlas_material() with the same category and filter, without loading or
+     * packing the original texture files. See atlas::load_baked_pages().
+     * \note This does nothing if texture atlases are disabled.
+     */
+    bool load_baked_atlas(
+        const std::string& atlas_category,
+        const std::string& manifest_file,
+        material::filter   filt = material::filter::none);
+
     /**
      * \brief Creates a new material from a portion of a render target.
      * \param target The render target from which to read the pixels
@@ -389,6 +528,34 @@ public:
      */
     virtual std::shared_ptr<vertex_cache> create_vertex_cache(gui::vertex_cache::type type) = 0;
 
+    /**
+     * \brief Keeps all the materials, fonts, and atlases currently in use alive.
+     * \note This is used to preserve GPU resources across a UI re-load (see
+     * manager::set_fast_reload_enabled()). Without this, all resources would be
+     * released when the UI is closed, and loaded again from scratch when the UI
+     * is re-loaded. Resources are held until release_retained_resources() is called.
+     */
+    void retain_resources();
+
+    /**
+     * \brief Releases the resources held by retain_resources().
+     * \note Resources that are still in use are not affected. Other resources are
+     * destroyed, and pruned from the caches (see prune_resources()).
+     */
+    void release_retained_resources();
+
+    /**
+     * \brief Removes materials, fonts, and atlas pages that are no longer used from the caches.
+     * \note This is done automatically by release_retained_resources().
+     */
+    void prune_resources();
+
+    /**
+     * \brief Returns the cache of text layouts, shared by all texts using this renderer.
+     * \return The cache of text layouts
+     */
+    text_layout_cache& get_text_layout_cache();
+
     /**
      * \brief Notifies the renderer that the render window has been resized.
      * \param dimensions The new window dimensions
@@ -423,6 +590,15 @@ protected:
      */
     virtual void set_view_(const matrix4f& view_matrix) = 0;
 
+    /**
+     * \brief Restricts rendering to a rectangle on the GPU.
+     * \param rect The clipping rectangle, in screen-space coordinates (see set_view()),
+     * or nullptr to disable clipping
+     * \note This is only called if is_scissor_supported() is 'true'. The default
+     * implementation does nothing.
+     */
+    virtual void set_scissor_(const bounds2f* rect);
+
     /**
      * \brief Renders a set of quads.
      * \param mat The material to use for rendering, or null if none
@@ -435,6 +611,38 @@ protected:
     virtual void
     render_quads_(const material* mat, const std::vector<std::array<vertex, 4>>& quad_list) = 0;
 
+    /**
+     * \brief Renders a set of quads, repeating the texture within a region of the texture.
+     * \param mat The material to use for rendering
+     * \param quad_list The list of the quads you want to render
+     * \param tile_rect_list The region of the texture to repeat for each quad (in canvas UV)
+     * \note See render_tiled_quads(). Renderers which support quad tiling must override this
+     * function; the default implementation throws.
+     */
+    virtual void render_tiled_quads_(
+        const material*                           mat,
+        const std::vector<std::array<vertex, 4>>& quad_list,
+        const std::vector<bounds2f>&              tile_rect_list);
+
+    /**
+     * \brief Renders a set of quads using several materials.
+     * \param material_list The materials to use for rendering (null if none), one per slot
+     * \param quad_list The list of the quads you want to render
+     * \param slot_list The index of the material to use for each quad, in material_list
+     * \param tile_rect_list The tiling region of each quad, or empty if no quad is tiled
+     * \note This is called when rendering a multi-texture batch, see
+     * set_multi_texture_batching_enabled(). The default implementation splits the quads
+     * into consecutive runs sharing the same material, and renders each run with
+     * render_quads_() (or render_tiled_quads_()). Renderers which support multi-texture
+     * batching should override this function to render all the quads with a single draw
+     * call. Quads which are not tiled have an empty tiling region.
+     */
+    virtual void render_quads_multi_texture_(
+        const std::vector<const material*>&       material_list,
+        const std::vector<std::array<vertex, 4>>& quad_list,
+        const std::vector<std::size_t>&           slot_list,
+        const std::vector<bounds2f>&              tile_rect_list);
+
     /**
      * \brief Renders a vertex cache.
      * \param mat The material to use for rendering, or null if none
@@ -466,6 +674,16 @@ protected:
     virtual std::shared_ptr<material>
     create_material_(const std::string& file_name, material::filter filt) = 0;
 
+    /**
+     * \brief Creates a new material from a raw texture file (.lxtex).
+     * \param file The texture file
+     * \param filt The filtering to apply to the texture
+     * \return The new material
+     * \note Only called if is_texture_file_supported() is 'true'.
+     */
+    virtual std::shared_ptr<material>
+    create_material_texture_file_(const texture_file& file, material::filter filt);
+
     /**
      * \brief Creates a new atlas with a given texture filter mode.
      * \param filt The filtering to apply to the texture
@@ -498,27 +716,63 @@ protected:
     std::unordered_map<std::string, std::weak_ptr<gui::font>>     font_list_;
 
 private:
+    struct quad_batcher;
+
     bool uses_same_texture_(const material* mat1, const material* mat2) const;
+    void add_quads_(
+        const material*                           mat,
+        const std::vector<std::array<vertex, 4>>& quad_list,
+        const std::vector<bounds2f>*              tile_rect_list);
+    void add_to_multi_texture_batch_(
+        const material*                           mat,
+        const std::vector<std::array<vertex, 4>>& quad_list,
+        const std::vector<bounds2f>*              tile_rect_list);
+    void add_tile_rects_(
+        quad_batcher&                cache,
+        std::size_t                  first_quad,
+        const std::vector<bounds2f>* tile_rect_list);
+    std::shared_ptr<material>
+    create_material_raw_file_(const std::string& file_name, material::filter filt);
+
+    std::vector<std::shared_ptr<gui::material>> retained_material_list_;
+    std::vector<std::shared_ptr<gui::font>>     retained_font_list_;
+
+    text_layout_cache text_layout_cache_;
 
     bool        texture_atlas_enabled_   = true;
     bool        vertex_cache_enabled_    = true;
     bool        quad_batching_enabled_   = true;
+    bool        multi_texture_enabled_   = false;
     std::size_t texture_atlas_page_size_ = 0u;
 
     struct quad_batcher {
         std::vector<std::array<vertex, 4>> data;
         std::shared_ptr<vertex_cache>      cache;
+
+        // Only used for multi-texture batching
+        std::vector<const gui::material*> material_list;
+        std::vector<std::size_t>          slot_list;
+
+        // Only used if the batch contains tiled quads
+        std::vector<bounds2f> tile_rect_list;
     };
 
     static constexpr std::size_t                        batching_cache_cycle_size = 16u;
     std::array<quad_batcher, batching_cache_cycle_size> quad_cache_;
 
-    const gui::material* current_material_        = nullptr;
-    std::size_t          current_quad_cache_      = 0u;
-    std::size_t          batch_count_             = 0u;
-    std::size_t          vertex_count_            = 0u;
-    std::size_t          last_frame_batch_count_  = 0u;
-    std::size_t          last_frame_vertex_count_ = 0u;
+    // Clipping rectangles, in screen-space coordinates
+    std::vector<bounds2f> clip_rect_stack_;
+
+    const gui::material* current_material_               = nullptr;
+    std::size_t          current_quad_cache_             = 0u;
+    std::size_t          batch_count_                    = 0u;
+    std::size_t          vertex_count_                   = 0u;
+    std::size_t          culled_frame_count_             = 0u;
+    std::size_t          culled_region_count_            = 0u;
+    std::size_t          last_frame_batch_count_         = 0u;
+    std::size_t          last_frame_vertex_count_        = 0u;
+    std::size_t          last_frame_culled_frame_count_  = 0u;
+    std::size_t          last_frame_culled_region_count_ = 0u;
 };
 
 } // namespace lxgui::gui
@@ -14,6 +14,13 @@
 
 #include <list>
 #include <memory>
+#include <vector>
+
+namespace lxgui::utils {
+
+class thread_pool;
+
+}
 
 namespace lxgui::input {
 
@@ -98,6 +105,124 @@ public:
     /// Notifies the root that it should update the hovered frame.
     void notify_hovered_frame_dirty();
 
+    /**
+     * \brief Registers a frame with playing animation groups.
+     * \param obj The frame
+     * \note Called automatically when an animation group starts playing. Registered frames
+     * are updated by update() (see frame::update_animations()) until they stop playing.
+     */
+    void register_animated_frame(frame& obj);
+
+    /**
+     * \brief Registers a frame rendered into a cached bitmap.
+     * \param obj The frame
+     * \note Called automatically by frame::set_render_cached(). Registered frames have
+     * their cached bitmap rendered again by update() when needed, before the strata are
+     * redrawn (see frame::update_render_cache()).
+     */
+    void register_render_cached_frame(frame& obj);
+
+    /**
+     * \brief Starts a batch of layout changes.
+     * \details Until the matching call to end_layout_batch(), regions which need to update
+     * their borders are only queued (see queue_borders_update()). When the batch ends, the
+     * queued regions, and the regions anchored to them, are sorted by order of dependency,
+     * and the borders of each region are updated at most once (see resolve_layout()).
+     * Batches can be nested; the layout is resolved when the outermost batch ends.
+     * \note While a batch is active, the borders of regions are not up to date. Reading them
+     * with region::get_borders() (or get_left(), get_apparent_dimensions(), etc.) resolves
+     * the queued updates first, so the value read is always correct; but each such read
+     * in the middle of a batch reduces the benefit of batching.
+     */
+    void begin_layout_batch();
+
+    /**
+     * \brief Ends a batch of layout changes.
+     * \see begin_layout_batch()
+     */
+    void end_layout_batch();
+
+    /**
+     * \brief Enables or disables deferred layout.
+     * \param enabled 'true' to enable deferred layout, 'false' to disable it
+     * \details When enabled, all border updates are queued, and resolved once per frame,
+     * at the end of update(), before rendering. This is as if the whole frame was enclosed
+     * in a layout batch (see begin_layout_batch()). This is disabled by default.
+     * \note When enabled, the borders of regions are only up to date after update() is
+     * called, or when they are read (see begin_layout_batch()).
+     */
+    void set_deferred_layout_enabled(bool enabled);
+
+    /**
+     * \brief Checks if deferred layout is enabled.
+     * \return 'true' if deferred layout is enabled
+     * \see set_deferred_layout_enabled()
+     */
+    bool is_deferred_layout_enabled() const;
+
+    /**
+     * \brief Checks if border updates are currently queued rather than immediate.
+     * \return 'true' if border updates are queued
+     * \see begin_layout_batch()
+     */
+    bool is_layout_deferred() const;
+
+    /**
+     * \brief Queues a region for updating its borders.
+     * \param obj The region to update
+     * \note This is called by region::notify_borders_need_update() when the layout is
+     * deferred, see is_layout_deferred().
+     */
+    void queue_borders_update(region& obj);
+
+    /**
+     * \brief Notifies the root that the anchors of a region have changed.
+     * \note This is called by region when its anchors are set, modified, or cleared. If this
+     * happens while resolving the layout (e.g., in an `OnSizeChanged` callback), the remaining
+     * regions are sorted again before their borders are updated (see resolve_layout()).
+     */
+    void notify_anchors_changed();
+
+    /**
+     * \brief Checks if some regions have queued border updates, not resolved yet.
+     * \return 'true' if some border updates are queued, and the layout is not being resolved
+     * \see resolve_layout()
+     */
+    bool has_pending_layout() const;
+
+    /**
+     * \brief Updates the borders of all the queued regions.
+     * \details Queued regions, and the regions anchored to them, are sorted in topological
+     * order of the anchor dependency graph. They are then updated in this order, so that the
+     * borders of each region are updated after those of the regions it is anchored to, and
+     * at most once. Regions anchored to a region whose borders did not change are skipped.
+     * If callbacks triggered by these updates change anchors, the dependency order is no
+     * longer valid: the regions which are not updated yet are sorted again. The hovered frame
+     * is updated once at the end, if needed.
+     */
+    void resolve_layout();
+
+    /**
+     * \brief Sets the number of worker threads used to resolve the layout.
+     * \param thread_count The number of worker threads (0 to disable multi-threading)
+     * \details When resolving the layout (see resolve_layout()), regions which do not depend
+     * on each other (i.e., which are at the same depth in the anchor dependency graph) have
+     * their borders computed in parallel. Script callbacks (such as `OnSizeChanged`) and
+     * other notifications are then triggered on the main thread, in the same order as
+     * with a single thread. This is disabled by default.
+     * \note This only speeds up layouts involving a large number of regions, such as
+     * resizing the window of a complex interface. The main thread also takes part in the
+     * work, so the total number of threads is thread_count + 1.
+     */
+    void set_layout_thread_count(std::size_t thread_count);
+
+    /**
+     * \brief Returns the number of worker threads used to resolve the layout.
+     * \return The number of worker threads used to resolve the layout
+     * \see set_layout_thread_count()
+     */
+    std::size_t get_layout_thread_count() const;
+
     /**
      * \brief Returns the currently hovered frame, if any.
      * \return The currently hovered frame, if any.
@@ -287,14 +412,22 @@ public:
     }
 
 private:
-    void create_caching_render_target_();
-    void create_strata_cache_render_target_(strata_data& strata_obj);
+    void     create_caching_render_target_();
+    void     create_strata_cache_render_target_(strata_data& strata_obj);
+    bounds2f get_screen_bounds_() const;
 
     void clear_hovered_frame_();
     void update_hovered_frame_();
     void
     set_hovered_frame_(utils::observer_ptr<frame> obj, const vector2f& mouse_pos = vector2f::zero);
 
+    std::vector<std::vector<utils::observer_ptr<region>>> sort_layout_queue_();
+
+    void resolve_layout_level_(const std::vector<utils::observer_ptr<region>>& level);
+
+    void update_animations_(float delta);
+    void update_render_caches_();
+
     void on_window_resized_(const vector2ui& dimensions);
     bool on_mouse_moved_(const input::mouse_moved_data& args);
     bool on_mouse_wheel_(const input::mouse_wheel_data& args);
@@ -323,6 +456,30 @@ private:
     std::shared_ptr<render_target> target_;
     quad                           screen_quad_;
 
+    // Layout
+    struct layout_job {
+        std::size_t index = 0u;
+        region*     obj   = nullptr;
+        bounds2f    old_border_list;
+        bool        old_valid = true;
+        vector2f    target_dimensions;
+    };
+
+    std::vector<utils::observer_ptr<region>> layout_queue_;
+    std::size_t                              layout_batch_depth_         = 0u;
+    bool                                     is_deferred_layout_enabled_ = false;
+    bool                                     is_resolving_layout_        = false;
+    bool                                     is_hovered_frame_dirty_     = false;
+    std::size_t                              anchor_generation_          = 0u;
+    std::unique_ptr<utils::thread_pool>      layout_thread_pool_;
+    std::vector<layout_job>                  layout_job_list_;
+
+    // Animations
+    std::vector<utils::observer_ptr<frame>> animated_frame_list_;
+
+    // Cached frames
+    std::vector<utils::observer_ptr<frame>> render_cached_frame_list_;
+
     // IO
     std::vector<utils::scoped_connection> connections_;
 
@@ -13,11 +13,13 @@ class texture;
 /**
  * \brief A #frame with scrollable content.
  * \details This frame has a special child frame, the "scroll child". The scroll
- * child is rendered on a separate render target, which is then rendered
- * on the screen. This allows clipping the content of the scroll child
- * and only display a portion of it (as if scrolling on a page). The
- * displayed portion is controlled by the scroll value, which can be
- * changed in both the vertical and horizontal directions.
+ * child is clipped to the borders of the scroll frame, so that only a portion of
+ * it is displayed (as if scrolling on a page). The displayed portion is controlled
+ * by the scroll value, which can be changed in both the vertical and horizontal
+ * directions. Depending on the renderer and the scroll mode, the scroll child is
+ * either rendered directly with a clipping rectangle, or rendered on a separate
+ * render target, which is then rendered on the screen (see
+ * set_scissor_clipping_enabled()).
  *
  * By default, the mouse wheel movement will not trigger any scrolling;
  * this has to be explicitly implemented using the `OnMouseWheel` callback
@@ -126,6 +128,53 @@ public:
      */
     float get_vertical_scroll_range() const;
 
+    /**
+     * \brief Enables or disables translation-only scrolling.
+     * \param enabled 'true' to enable translation-only scrolling, 'false' to disable it
+     * \details By default, scrolling moves the anchor of the scroll child. This updates the
+     * borders of every frame in the scroll child, and redraws all of them. With
+     * translation-only scrolling, the scroll child stays in place, and the scroll offset is
+     * only applied as a view transform when rendering, and to the mouse position when
+     * looking for hovered frames. The content is rendered with a margin around the visible
+     * area, so small scrolls only need to display another portion of the render target.
+     * Frames which are entirely outside of the rendered area are neither rendered, nor
+     * tested for mouse input.
+     * \note In this mode, the borders of the frames in the scroll child do not include the
+     * scroll offset (see get_render_offset()). Frames are culled based on their render
+     * bounds (see frame::get_render_bounds()).
+     */
+    void set_translation_scroll_enabled(bool enabled);
+
+    /**
+     * \brief Checks if translation-only scrolling is enabled.
+     * \return 'true' if translation-only scrolling is enabled
+     * \see set_translation_scroll_enabled()
+     */
+    bool is_translation_scroll_enabled() const;
+
+    /**
+     * \brief Enables or disables rendering the scroll child without a render target.
+     * \param enabled 'true' to render the scroll child directly when possible
+     * \details When enabled (the default), if the renderer can clip rendering on the GPU
+     * (see renderer::is_scissor_supported()) and translation-only scrolling is disabled,
+     * the scroll child is rendered directly on the same render target as this scroll_frame,
+     * clipped to its borders (see renderer::push_clip_rect()). This avoids allocating,
+     * clearing, and drawing an extra render target for each scroll_frame. Otherwise, the
+     * scroll child is rendered on a separate render target, displayed by a texture in the
+     * artwork layer of this scroll_frame.
+     * \note When rendered directly, the scroll child is drawn between the border and artwork
+     * layers of this scroll_frame, like the texture displaying the render target. Renderers
+     * without scissor support always use a render target.
+     */
+    void set_scissor_clipping_enabled(bool enabled);
+
+    /**
+     * \brief Checks if rendering the scroll child without a render target is enabled.
+     * \return 'true' if rendering the scroll child without a render target is enabled
+     * \see set_scissor_clipping_enabled()
+     */
+    bool is_scissor_clipping_enabled() const;
+
     /**
      * \brief Find the topmost frame matching the provided predicate
      * \param predicate A function returning 'true' if the frame can be selected
@@ -148,6 +197,13 @@ public:
      */
     vector2f get_target_dimensions() const override;
 
+    /**
+     * \brief Returns the offset between rendered frames and their on-screen position.
+     * \return The offset to add to the borders of a rendered frame to get its on-screen position
+     * \note This is non-zero only if translation-only scrolling is enabled.
+     */
+    vector2f get_render_offset() const override;
+
     /// Tells this region that the global interface scaling factor has changed.
     void notify_scaling_factor_updated() override;
 
@@ -157,20 +213,33 @@ public:
     static constexpr const char* class_name = "ScrollFrame";
 
 protected:
+    void         parse_attributes_(const layout_node& node) override;
     void         parse_all_nodes_before_children_(const layout_node& node) override;
     virtual void parse_scroll_child_node_(const layout_node& node);
 
     void update_(float delta) override;
+    void render_layered_regions_(const bounds2f* clip_bounds) const override;
 
     const std::vector<std::string>& get_type_list_() const override;
 
     void update_scroll_range_();
+    void update_scroll_offset_();
     void rebuild_scroll_render_target_();
     void render_scroll_strata_list_();
 
+    bool     uses_render_target_() const;
+    vector2f get_scroll_cache_size_() const;
+    bool     is_in_scroll_cache_() const;
+    void     update_scroll_cache_origin_();
+    void     update_scroll_texture_rect_();
+
     vector2f scroll_;
     vector2f scroll_range_;
 
+    bool     is_translation_scroll_enabled_ = false;
+    bool     is_scissor_clipping_enabled_   = true;
+    vector2f scroll_cache_origin_;
+
     utils::observer_ptr<frame> scroll_child_ = nullptr;
     utils::scoped_connection   scroll_child_on_resize_connection_;
 
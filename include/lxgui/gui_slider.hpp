@@ -188,9 +188,6 @@ public:
      */
     bool is_in_region(const vector2f& position) const override;
 
-    /// Tells this region that its borders need updating.
-    void notify_borders_need_update() override;
-
     /// Registers this region class to the provided Lua state
     static void register_on_lua(sol::state& lua);
 
@@ -202,6 +199,8 @@ protected:
 
     void notify_thumb_texture_needs_update_();
 
+    void notify_borders_updated_(const bounds2f& old_border_list, bool old_valid) override;
+
     void parse_attributes_(const layout_node& node) override;
     void parse_all_nodes_before_children_(const layout_node& node) override;
 
@@ -5,6 +5,7 @@
 #include "lxgui/gui_font.hpp"
 #include "lxgui/gui_matrix4.hpp"
 #include "lxgui/gui_quad.hpp"
+#include "lxgui/gui_text_layout.hpp"
 #include "lxgui/lxgui.hpp"
 #include "lxgui/utils.hpp"
 #include "lxgui/utils_maths.hpp"
@@ -21,10 +22,6 @@ class renderer;
 class vertex_cache;
 struct vertex;
 
-enum class alignment_x { left, center, right };
-
-enum class alignment_y { top, middle, bottom };
-
 /// Used to draw some text on the screen
 class text {
 public:
@@ -428,6 +425,8 @@ private:
     void notify_cache_dirty_() const;
     void notify_vertex_cache_dirty_() const;
 
+    std::shared_ptr<text_layout> create_layout_() const;
+
     float round_to_pixel_(
         float value, utils::rounding_method method = utils::rounding_method::nearest) const;
 
@@ -456,18 +455,13 @@ private:
     std::shared_ptr<const font> outline_font_;
     utils::ustring              unicode_text_;
 
-    mutable bool        update_cache_flag_ = false;
-    mutable float       width_             = 0.0f;
-    mutable float       height_            = 0.0f;
-    mutable std::size_t num_lines_         = 0u;
-
-    bool                                       use_vertex_cache_flag_    = false;
-    mutable bool                               update_vertex_cache_flag_ = false;
-    mutable std::vector<std::array<vertex, 4>> quad_list_;
-    mutable std::shared_ptr<vertex_cache>      vertex_cache_;
-    mutable std::vector<std::array<vertex, 4>> outline_quad_list_;
-    mutable std::shared_ptr<vertex_cache>      outline_vertex_cache_;
-    mutable std::vector<quad>                  icons_list_;
+    mutable bool                               update_cache_flag_ = false;
+    mutable std::shared_ptr<const text_layout> layout_;
+
+    bool                                  use_vertex_cache_flag_    = false;
+    mutable bool                          update_vertex_cache_flag_ = false;
+    mutable std::shared_ptr<vertex_cache> vertex_cache_;
+    mutable std::shared_ptr<vertex_cache> outline_vertex_cache_;
 };
 
 } // namespace lxgui::gui
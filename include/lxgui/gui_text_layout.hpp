@@ -0,0 +1,133 @@
+#ifndef LXGUI_GUI_TEXT_LAYOUT_HPP
+#define LXGUI_GUI_TEXT_LAYOUT_HPP
+
+#include "lxgui/gui_color.hpp"
+#include "lxgui/gui_quad.hpp"
+#include "lxgui/gui_vertex.hpp"
+#include "lxgui/lxgui.hpp"
+#include "lxgui/utils.hpp"
+#include "lxgui/utils_string.hpp"
+
+#include <array>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace lxgui::gui {
+
+class font;
+class vertex_cache;
+
+enum class alignment_x { left, center, right };
+
+enum class alignment_y { top, middle, bottom };
+
+/// Parameters that fully determine the layout of a text
+struct text_layout_key {
+    const font*    fnt         = nullptr;
+    const font*    outline_fnt = nullptr;
+    utils::ustring content;
+
+    float       scaling_factor         = 1.0f;
+    float       tracking               = 0.0f;
+    float       line_spacing           = 1.0f;
+    bool        remove_starting_spaces = false;
+    bool        word_wrap_enabled      = true;
+    bool        ellipsis_enabled       = false;
+    bool        formatting_enabled     = false;
+    float       box_width              = 0.0f;
+    float       box_height             = 0.0f;
+    alignment_x align_x                = alignment_x::left;
+    alignment_y align_y                = alignment_y::middle;
+
+    bool operator==(const text_layout_key& other) const;
+};
+
+/**
+ * \brief Glyph quads and metrics of a text, once laid out.
+ * \details This is immutable once created, and shared by all the text objects which
+ * display the same content with the same parameters (see text_layout_cache).
+ */
+struct text_layout {
+    /// Vertex caches for a given color, shared by all text objects using it.
+    struct colored_cache {
+        color                         col         = color::white;
+        bool                          force_color = false;
+        float                         alpha       = 1.0f;
+        std::shared_ptr<vertex_cache> cache;
+        std::shared_ptr<vertex_cache> outline_cache;
+    };
+
+    std::shared_ptr<const font> fnt;
+    std::shared_ptr<const font> outline_fnt;
+
+    float       width     = 0.0f;
+    float       height    = 0.0f;
+    std::size_t num_lines = 0u;
+
+    std::vector<std::array<vertex, 4>> quad_list;
+    std::vector<std::array<vertex, 4>> outline_quad_list;
+    std::vector<quad>                  icons_list;
+
+    mutable std::vector<colored_cache> colored_cache_list;
+};
+
+/**
+ * \brief Shares the layout of identical texts.
+ * \details Many text objects display the same string, with the same font and the same
+ * parameters (for example, the normal, highlight, and disabled texts of a button, or
+ * rows of a list). The layout of the text (parsing, word wrapping, and generation of
+ * glyph quads) is then computed only once, and shared. Layouts are reference counted:
+ * this cache does not keep them alive, and they are destroyed when the last text object
+ * using them is destroyed or changes its parameters.
+ */
+class text_layout_cache {
+public:
+    /// Maximum number of vertex caches kept per layout, see text_layout::colored_cache.
+    static constexpr std::size_t max_colored_caches = 4u;
+
+    /// Default constructor.
+    text_layout_cache() = default;
+
+    // Non-copiable, non-movable
+    text_layout_cache(const text_layout_cache&)            = delete;
+    text_layout_cache(text_layout_cache&&)                 = delete;
+    text_layout_cache& operator=(const text_layout_cache&) = delete;
+    text_layout_cache& operator=(text_layout_cache&&)      = delete;
+
+    /**
+     * \brief Finds a layout in the cache.
+     * \param key The parameters of the layout
+     * \return The layout, or nullptr if not found
+     */
+    std::shared_ptr<const text_layout> find(const text_layout_key& key) const;
+
+    /**
+     * \brief Adds a new layout to the cache.
+     * \param key The parameters of the layout
+     * \param layout The layout
+     */
+    void insert(const text_layout_key& key, const std::shared_ptr<const text_layout>& layout);
+
+    /// Removes layouts that are no longer used from the cache.
+    void prune();
+
+    /**
+     * \brief Returns the number of layouts in the cache.
+     * \return The number of layouts in the cache
+     * \note This includes layouts that are no longer used, and not yet pruned.
+     */
+    std::size_t get_size() const;
+
+private:
+    struct key_hash {
+        std::size_t operator()(const text_layout_key& key) const;
+    };
+
+    std::unordered_map<text_layout_key, std::weak_ptr<const text_layout>, key_hash> layout_list_;
+    std::size_t next_prune_size_ = 64u;
+};
+
+} // namespace lxgui::gui
+
+#endif
@@ -242,7 +242,7 @@ private:
     const std::vector<std::string>& get_type_list_() const override;
 
     void update_dimensions_from_tex_coord_();
-    void update_borders_() override;
+    void notify_borders_updated_(const bounds2f& old_border_list, bool old_valid) override;
 
     using content    = std::variant<color, std::string, gradient>;
     content content_ = color::white;
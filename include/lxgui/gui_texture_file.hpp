@@ -0,0 +1,99 @@
+#ifndef LXGUI_GUI_TEXTURE_FILE_HPP
+#define LXGUI_GUI_TEXTURE_FILE_HPP
+
+#include "lxgui/gui_color.hpp"
+#include "lxgui/gui_vector2.hpp"
+#include "lxgui/lxgui.hpp"
+#include "lxgui/utils.hpp"
+#include "lxgui/utils_mapped_file.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace lxgui::gui {
+
+/**
+ * \brief A raw texture file (.lxtex), ready to be uploaded to the GPU.
+ * \details This file format stores uncompressed RGBA8 pixels with pre-multiplied alpha,
+ * optionally followed by pre-computed mipmap levels, so that loading a texture requires
+ * neither decompression nor any processing of the pixels. The file is mapped in memory,
+ * and the pixels can be uploaded directly from the mapping.
+ *
+ * The file starts with a texture_file::header, immediately followed by the pixels of
+ * each level, from the largest (the texture itself) to the smallest. Each level is half
+ * the size of the previous level (rounded down, and at least one pixel). Pixels are
+ * stored row by row, with no padding. All integers are stored in little-endian order.
+ *
+ * These files are generated from PNG files with the lxgui-texture-convert tool. When a
+ * .lxtex file exists next to a texture file, with the same name, and is at least as
+ * recent, it is loaded instead of the texture file (see renderer::create_material()).
+ */
+class texture_file {
+public:
+    /// Header of a .lxtex file.
+    struct header {
+        char          magic[4]   = {'L', 'X', 'T', 'X'};
+        std::uint32_t version    = 1u;
+        std::uint32_t width      = 0u;
+        std::uint32_t height     = 0u;
+        std::uint32_t num_levels = 1u;
+        std::uint32_t flags      = 0u;
+    };
+
+    /// Flags of a .lxtex file.
+    enum flag : std::uint32_t {
+        /// Pixels are stored with pre-multiplied alpha
+        premultiplied_alpha = 1u
+    };
+
+    /**
+     * \brief Opens a .lxtex file.
+     * \param file_name The name of the file
+     * \note Throws a gui::exception if the file cannot be opened, or is not a valid file.
+     */
+    explicit texture_file(const std::string& file_name);
+
+    /**
+     * \brief Returns the dimensions of the texture, in pixels.
+     * \return The dimensions of the texture, in pixels
+     */
+    const vector2ui& get_dimensions() const;
+
+    /**
+     * \brief Returns the number of levels in the file (including the texture itself).
+     * \return The number of levels in the file (including the texture itself)
+     */
+    std::size_t get_num_levels() const;
+
+    /**
+     * \brief Returns the dimensions of a level, in pixels.
+     * \param level The level (0 for the texture itself)
+     * \return The dimensions of the level, in pixels
+     */
+    vector2ui get_level_dimensions(std::size_t level) const;
+
+    /**
+     * \brief Returns the pixels of a level.
+     * \param level The level (0 for the texture itself)
+     * \return The pixels of the level, pointing directly inside the mapped file
+     * \note The pointer remains valid as long as this object is alive.
+     */
+    const color32* get_level_data(std::size_t level) const;
+
+    /**
+     * \brief Returns the name of the .lxtex file associated to a texture file.
+     * \param file_name The name of the texture file
+     * \return The name of the .lxtex file associated to the texture file
+     */
+    static std::string get_file_name(const std::string& file_name);
+
+private:
+    utils::mapped_file file_;
+    vector2ui          dimensions_;
+    std::size_t        num_levels_ = 0u;
+};
+
+} // namespace lxgui::gui
+
+#endif
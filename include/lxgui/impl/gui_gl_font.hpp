@@ -1,16 +1,98 @@
 #ifndef LXGUI_GUI_GL_FONT_HPP
 #define LXGUI_GUI_GL_FONT_HPP
 
+#include "lxgui/gui_code_point_map.hpp"
 #include "lxgui/gui_font.hpp"
 #include "lxgui/impl/gui_gl_material.hpp"
 #include "lxgui/utils.hpp"
 
 #include <ft2build.h>
+#include <unordered_map>
 #include <vector>
 #include FT_FREETYPE_H
 
 namespace lxgui::gui::gl {
 
+/**
+ * \brief A font face rendered as a signed distance field
+ * \details Glyphs are rasterized once at a fixed reference size, and the texture stores
+ * for each texel the distance to the nearest glyph edge, rather than the glyph coverage.
+ * Rendering a glyph then amounts to thresholding this distance in the fragment shader
+ * (see gl::material::set_distance_field()), which gives sharp edges at any scale. The same
+ * texture can thus be shared by all the gl::font objects using this face, whatever their
+ * size or outline thickness.
+ */
+class distance_field_face {
+public:
+    /// Size at which glyphs are rasterized (in pixels).
+    static constexpr std::size_t reference_size = 48u;
+    /// Largest distance to the glyph edge stored in the texture (in pixels, at reference size).
+    static constexpr std::size_t spread = 8u;
+
+    struct character_info {
+        char32_t code_point  = 0;
+        FT_UInt  glyph_index = 0;
+        bounds2f uvs;
+        bounds2f rect;
+        float    advance = 0.0f;
+    };
+
+    struct range_info {
+        code_point_range            range;
+        std::vector<character_info> data;
+    };
+
+    /**
+     * \brief Constructor.
+     * \param font_file The name of the font file to read
+     * \param code_points The list of Unicode characters to load
+     */
+    distance_field_face(
+        const std::string& font_file, const std::vector<code_point_range>& code_points);
+
+    // Non-copiable, non-movable
+    distance_field_face(const distance_field_face&)            = delete;
+    distance_field_face(distance_field_face&&)                 = delete;
+    distance_field_face& operator=(const distance_field_face&) = delete;
+    distance_field_face& operator=(distance_field_face&&)      = delete;
+
+    /// Destructor.
+    ~distance_field_face();
+
+    /**
+     * \brief Returns the characters of this face, with metrics at the reference size.
+     * \return The characters of this face, with metrics at the reference size
+     */
+    const std::vector<range_info>& get_range_list() const;
+
+    /**
+     * \brief Returns the distance field texture.
+     * \return The distance field texture
+     */
+    const std::shared_ptr<gl::material>& get_texture() const;
+
+    /**
+     * \brief Checks if this face has kerning information.
+     * \return 'true' if this face has kerning information, 'false' otherwise
+     */
+    bool has_kerning() const;
+
+    /**
+     * \brief Return the kerning amount between two glyphs, at the reference size.
+     * \param glyph1 The index of the first glyph
+     * \param glyph2 The index of the second glyph
+     * \return The kerning amount between the two glyphs (in pixels, at the reference size)
+     */
+    float get_kerning(FT_UInt glyph1, FT_UInt glyph2) const;
+
+private:
+    FT_Face face_    = nullptr;
+    bool    kerning_ = false;
+
+    std::shared_ptr<gl::material> texture_;
+    std::vector<range_info>       range_list_;
+};
+
 /**
  * \brief A texture containing characters
  * This is the OpenGL implementation of the gui::font.
@@ -34,6 +116,20 @@ public:
         const std::vector<code_point_range>& code_points,
         char32_t                             default_code_point);
 
+    /**
+     * \brief Constructor for distance field fonts.
+     * \param face The distance field face to render
+     * \param size The requested size of the characters (in points)
+     * \param outline The thickness of the outline (in points)
+     * \param default_code_point The character to display as fallback
+     * \note No rasterization takes place here: the texture of the face is shared.
+     */
+    font(
+        std::shared_ptr<const distance_field_face> face,
+        std::size_t                                size,
+        std::size_t                                outline,
+        char32_t                                   default_code_point);
+
     /// Destructor.
     ~font() override;
 
@@ -73,6 +169,17 @@ public:
      */
     float get_character_height(char32_t c) const override;
 
+    /**
+     * \brief Returns the metrics of several characters at once.
+     * \param characters The unicode characters
+     * \param count The number of characters
+     * \param output The array that will receive the metrics (must have room for 'count' elements)
+     * \note This is equivalent to calling get_character_uvs(), get_character_bounds(), and
+     * get_character_width() for each character, but faster.
+     */
+    void get_character_metrics(
+        const char32_t* characters, std::size_t count, character_metrics* output) const override;
+
     /**
      * \brief Return the kerning amount between two characters.
      * \param c1 The first unicode character
@@ -97,18 +204,18 @@ public:
      */
     void update_texture(std::shared_ptr<gui::material> mat) override;
 
+    /**
+     * \brief Checks if this font can be copied into a texture atlas.
+     * \return 'true' if this font can be copied into a texture atlas, 'false' otherwise
+     * \note Distance field fonts share their texture, and are not copied into atlases.
+     */
+    bool is_atlas_compatible() const override;
+
 private:
-    struct character_info {
-        char32_t code_point = 0;
-        bounds2f uvs;
-        bounds2f rect;
-        float    advance = 0.0f;
-    };
+    using character_info = distance_field_face::character_info;
+    using range_info     = distance_field_face::range_info;
 
-    struct range_info {
-        code_point_range            range;
-        std::vector<character_info> data;
-    };
+    void build_character_map_();
 
     const character_info* get_character_(char32_t c) const;
 
@@ -119,6 +226,14 @@ private:
 
     std::shared_ptr<gl::material> texture_;
     std::vector<range_info>       range_list_;
+
+    std::shared_ptr<const distance_field_face> distance_field_;
+    float                                      distance_field_scale_ = 1.0f;
+
+    code_point_map<const character_info*> character_map_;
+    const character_info*                 default_character_ = nullptr;
+
+    mutable std::unordered_map<std::uint64_t, float> kerning_cache_;
 };
 
 } // namespace lxgui::gui::gl
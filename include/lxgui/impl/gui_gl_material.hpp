@@ -109,6 +109,28 @@ public:
      */
     filter get_filter() const;
 
+    /**
+     * \brief Flags this material as a signed distance field.
+     * \param threshold The distance at which to draw the edge of the shape (in [0,1])
+     * \note Distance field materials are rendered with a dedicated shader, which reads the
+     * alpha channel of the texture as the distance to the edge of the shape, rather than as
+     * an opacity. Lowering the threshold makes the shape thicker. See gl::distance_field_face.
+     */
+    void set_distance_field(float threshold);
+
+    /**
+     * \brief Checks if this material is a signed distance field.
+     * \return 'true' if this material is a signed distance field, 'false' otherwise
+     */
+    bool is_distance_field() const;
+
+    /**
+     * \brief Returns the distance at which to draw the edge of the shape.
+     * \return The distance at which to draw the edge of the shape
+     * \note Only used if is_distance_field() is 'true'.
+     */
+    float get_distance_field_threshold() const;
+
     /// Sets this material as the active one.
     void bind() const;
 
@@ -118,6 +140,16 @@ public:
      */
     void update_texture(const color32* data);
 
+    /**
+     * \brief Updates a mipmap level of the texture that is in GPU memory.
+     * \param level The mipmap level (starting at 1 for the first mipmap)
+     * \param data The new pixel data
+     * \note Levels must be updated in order. Mipmaps are only used with linear filtering,
+     * once at least one level has been set. The texture must fill its canvas, and the size
+     * of each level is half the size of the previous level (rounded down).
+     */
+    void update_mipmap(std::size_t level, const color32* data);
+
     /**
      * \brief Returns the OpenGL texture handle.
      * \note For internal use.
@@ -144,7 +176,11 @@ private:
     filter        filter_         = filter::none;
     std::uint32_t texture_handle_ = 0u;
     bounds2f      rect_;
-    bool          is_owner_ = false;
+    bool          is_owner_    = false;
+    std::size_t   num_mipmaps_ = 0u;
+
+    bool  is_distance_field_        = false;
+    float distance_field_threshold_ = 0.5f;
 
     static bool        only_power_of_two;
     static std::size_t maximum_size;
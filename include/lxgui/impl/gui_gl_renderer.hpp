@@ -3,6 +3,7 @@
 
 #include "lxgui/impl/gui_gl_render_target.hpp"
 #if defined(LXGUI_OPENGL3)
+#    include "lxgui/impl/gui_gl_stream_buffer.hpp"
 #    include "lxgui/impl/gui_gl_vertex_cache.hpp"
 #endif
 
@@ -13,9 +14,13 @@
 #include <array>
 #include <limits>
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 namespace lxgui::gui::gl {
 
+class distance_field_face;
+
 /// Open implementation of rendering
 class renderer final : public gui::renderer {
 public:
@@ -62,6 +67,19 @@ public:
      */
     bool is_texture_vertex_color_supported() const override;
 
+    /**
+     * \brief Checks if the renderer supports repeating a texture within a region of the texture.
+     * \return 'true' if supported, 'false' otherwise
+     * \note Only supported with OpenGL 3 / WebGL, where textures are sampled in a shader.
+     */
+    bool is_quad_tiling_supported() const override;
+
+    /**
+     * \brief Checks if the renderer supports raw texture files (.lxtex).
+     * \return 'true' if supported, 'false' otherwise
+     */
+    bool is_texture_file_supported() const override;
+
     /**
      * \brief Creates a new material from arbitrary pixel data.
      * \param dimensions The dimensions of the material
@@ -104,12 +122,101 @@ public:
      */
     std::shared_ptr<gui::vertex_cache> create_vertex_cache(gui::vertex_cache::type type) override;
 
+    /**
+     * \brief Checks if the renderer can clip rendering to a rectangle on the GPU.
+     * \return 'true' if clipping is done on the GPU, 'false' otherwise
+     */
+    bool is_scissor_supported() const override;
+
+    /**
+     * \brief Checks if the renderer streams batched quads to the GPU directly.
+     * \return 'true' if quads are streamed, 'false' otherwise
+     */
+    bool is_quad_streaming_enabled() const override;
+
+    /**
+     * \brief Returns the maximum number of textures that a single quad batch can use.
+     * \return The maximum number of textures that a single quad batch can use
+     * \note Multi-texture batches are rendered in a single draw call only if quad
+     * streaming is enabled (see set_quad_streaming_enabled()). Returns one with legacy
+     * OpenGL.
+     */
+    std::size_t get_batch_texture_slot_count() const override;
+
+    /**
+     * \brief Enables or disables streaming quads to the GPU.
+     * \param enabled 'true' to enable, 'false' to disable
+     * \note When enabled, quads rendered with render_quads() (including quad batches) are
+     * appended into a single large vertex buffer, and drawn with a base vertex offset.
+     * This avoids switching vertex buffers between batches, and waiting for the GPU to
+     * finish using a buffer before updating it. Batches too large to fit in this buffer
+     * are rendered as if streaming was disabled.
+     * \note Streaming is not supported with legacy OpenGL. Enabled by default otherwise.
+     */
+    void set_quad_streaming_enabled(bool enabled);
+
     /**
      * \brief Notifies the renderer that the render window has been resized.
      * \param new_dimensions The new window dimensions
      */
     void notify_window_resized(const vector2ui& new_dimensions) override;
 
+    /**
+     * \brief Enables or disables signed distance field fonts.
+     * \param enabled 'true' to enable, 'false' to disable
+     * \note Distance field fonts rasterize each font face only once, in a texture shared by
+     * all sizes and outline thicknesses. Changing the size of the text (for example, after
+     * changing the interface scaling factor) then requires no new rasterization and no extra
+     * texture memory. Text rendered this way is slightly less crisp at small sizes.
+     * \note This only affects fonts created after this call. Distance field fonts are not
+     * supported with legacy OpenGL. Disabled by default.
+     */
+    void set_distance_field_font_enabled(bool enabled);
+
+    /**
+     * \brief Checks if signed distance field fonts are enabled.
+     * \return 'true' if enabled, 'false' otherwise
+     */
+    bool is_distance_field_font_enabled() const;
+
+    /**
+     * \brief Enables or disables the packed vertex layout.
+     * \param enabled 'true' to enable, 'false' to disable
+     * \note When enabled, vertex data is converted to a compact layout (16 bytes per vertex
+     * instead of 32) when it is uploaded to the GPU, for batched quads and vertex caches
+     * alike. This halves the vertex bandwidth, at the cost of a small conversion on the CPU
+     * and a reduced precision for colors (8 bits per channel) and texture coordinates
+     * (16 bits). Vertices with texture coordinates outside of [0,1] keep the full layout.
+     * \note This affects all vertex caches created after this call, and the renderer's own
+     * caches. Packed vertices are not supported with legacy OpenGL. Disabled by default.
+     */
+    void set_packed_vertex_enabled(bool enabled);
+
+    /**
+     * \brief Checks if the packed vertex layout is enabled.
+     * \return 'true' if enabled, 'false' otherwise
+     */
+    bool is_packed_vertex_enabled() const;
+
+    /**
+     * \brief Enables or disables instanced quads.
+     * \param enabled 'true' to enable, 'false' to disable
+     * \note When enabled, quads whose edges are aligned with the axes (which is the case for
+     * text and most textures) are sent to the GPU as a single instance record each, instead
+     * of four vertices and six indices, and are expanded into triangles in the vertex shader.
+     * This applies to quads rendered with render_quads() (including quad batches) and to
+     * vertex caches of type QUADS. Other quads are rendered as regular vertices.
+     * \note This affects all vertex caches created after this call, and the renderer's own
+     * caches. Instanced quads are not supported with legacy OpenGL. Disabled by default.
+     */
+    void set_instanced_quads_enabled(bool enabled);
+
+    /**
+     * \brief Checks if instanced quads are enabled.
+     * \return 'true' if enabled, 'false' otherwise
+     */
+    bool is_instanced_quads_enabled() const;
+
 #if !defined(LXGUI_OPENGL3)
     /**
      * \brief Checks if a given OpenGL extension is supported by the machine.
@@ -129,6 +236,17 @@ protected:
     std::shared_ptr<gui::material>
     create_material_(const std::string& file_name, material::filter filt) override;
 
+    /**
+     * \brief Creates a new material from a raw texture file (.lxtex).
+     * \param file The texture file
+     * \param filt The filtering to apply to the texture
+     * \return The new material
+     * \note Pixels are uploaded directly from the mapped file, along with the mipmaps
+     * stored in the file (if any).
+     */
+    std::shared_ptr<gui::material>
+    create_material_texture_file_(const texture_file& file, material::filter filt) override;
+
     /**
      * \brief Creates a new atlas with a given texture filter mode.
      * \param filt The filtering to apply to the texture
@@ -180,6 +298,13 @@ protected:
      */
     void set_view_(const matrix4f& view_matrix) override;
 
+    /**
+     * \brief Restricts rendering to a rectangle on the GPU.
+     * \param rect The clipping rectangle, in screen-space coordinates (see set_view()),
+     * or nullptr to disable clipping
+     */
+    void set_scissor_(const bounds2f* rect) override;
+
     /**
      * \brief Renders a set of quads.
      * \param mat The material to use for rendering, or null if none
@@ -192,6 +317,36 @@ protected:
     void render_quads_(
         const gui::material* mat, const std::vector<std::array<vertex, 4>>& quad_list) override;
 
+    /**
+     * \brief Renders a set of quads, repeating the texture within a region of the texture.
+     * \param mat The material to use for rendering
+     * \param quad_list The list of the quads you want to render
+     * \param tile_rect_list The region of the texture to repeat for each quad (in canvas UV)
+     * \note The tiling regions are sent to the shader as an extra vertex attribute, next to
+     * the vertices in the stream buffer. Tiled quads are always streamed, since vertex caches
+     * do not hold tiling regions.
+     */
+    void render_tiled_quads_(
+        const gui::material*                      mat,
+        const std::vector<std::array<vertex, 4>>& quad_list,
+        const std::vector<bounds2f>&              tile_rect_list) override;
+
+    /**
+     * \brief Renders a set of quads using several materials.
+     * \param material_list The materials to use for rendering (null if none), one per slot
+     * \param quad_list The list of the quads you want to render
+     * \param slot_list The index of the material to use for each quad, in material_list
+     * \param tile_rect_list The tiling region of each quad, or empty if no quad is tiled
+     * \note Each material is bound to its own texture unit, and the shader selects the
+     * texture to sample from with a per-vertex texture slot. All the quads are rendered with
+     * a single draw call.
+     */
+    void render_quads_multi_texture_(
+        const std::vector<const gui::material*>&  material_list,
+        const std::vector<std::array<vertex, 4>>& quad_list,
+        const std::vector<std::size_t>&           slot_list,
+        const std::vector<bounds2f>&              tile_rect_list) override;
+
     /**
      * \brief Renders a vertex cache.
      * \param mat The material to use for rendering, or null if none
@@ -219,6 +374,7 @@ private:
 #if defined(LXGUI_OPENGL3)
     void compile_programs_();
     void setup_buffers_();
+    void setup_uniforms_(const gui::material* mat, const matrix4f& model_transform, bool instanced);
 #endif
 
     std::shared_ptr<gui::material>
@@ -226,6 +382,13 @@ private:
 
     vector2ui window_dimensions_;
 
+    bool distance_field_font_enabled_ = false;
+    std::unordered_map<std::string, std::weak_ptr<const gl::distance_field_face>>
+        distance_field_face_list_;
+
+    bool packed_vertex_enabled_   = false;
+    bool instanced_quads_enabled_ = false;
+
     std::shared_ptr<gui::gl::render_target> current_target_;
     matrix4f                                current_view_matrix_ = matrix4f::identity;
 
@@ -236,11 +399,15 @@ private:
         shader_cache(shader_cache&&)      = delete;
         ~shader_cache();
 
-        std::uint32_t program          = 0;
-        int           sampler_location = 0;
-        int           proj_location    = 0;
-        int           model_location   = 0;
-        int           type_location    = 0;
+        std::uint32_t program                 = 0;
+        int           sampler_location        = 0;
+        int           proj_location           = 0;
+        int           model_location          = 0;
+        int           type_location           = 0;
+        int           threshold_location      = 0;
+        int           instanced_location      = 0;
+        int           slot_type_location      = 0;
+        int           slot_threshold_location = 0;
     };
 
     static thread_local std::weak_ptr<shader_cache> static_shader_cache;
@@ -252,6 +419,11 @@ private:
     std::uint32_t                                                   quad_cycle_cache_  = 0u;
     std::uint32_t                                                   array_cycle_cache_ = 0u;
 
+    static constexpr std::size_t   texture_slot_count      = 8u;
+    static constexpr std::size_t   stream_buffer_capacity  = 65536u;
+    std::unique_ptr<stream_buffer> stream_buffer_;
+    bool                           quad_streaming_enabled_ = true;
+
     std::uint32_t previous_texture_ = std::numeric_limits<std::uint32_t>::max();
 #endif
 };
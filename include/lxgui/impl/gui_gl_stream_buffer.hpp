@@ -0,0 +1,162 @@
+#ifndef LXGUI_GUI_GL_STREAM_BUFFER_HPP
+#define LXGUI_GUI_GL_STREAM_BUFFER_HPP
+
+#include "lxgui/gui_bounds2.hpp"
+#include "lxgui/gui_vertex.hpp"
+#include "lxgui/impl/gui_gl_vertex_cache.hpp"
+#include "lxgui/lxgui.hpp"
+#include "lxgui/utils.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+
+namespace lxgui::gui::gl {
+
+/**
+ * \brief A large vertex buffer used to stream quads to the GPU.
+ * \details Batches of quads are appended one after the other into a single ring buffer,
+ * and each batch is drawn with a base vertex offset into this buffer. Compared to
+ * uploading each batch into its own vertex cache, this avoids switching buffer objects
+ * between batches, and avoids implicit synchronization with the GPU: the region of the
+ * buffer being written is never used by a pending draw call.
+ *
+ * On desktop OpenGL, the buffer is written through an unsynchronized mapping, and a fence
+ * is inserted at the end of each render pass (see fence()). When the buffer wraps around,
+ * the CPU only waits if the GPU has not finished reading the region to overwrite, and at
+ * most once per fence. If a single render pass fills the whole buffer, the buffer is
+ * orphaned rather than waited for. On WebGL, which does not support mapping buffers, the
+ * buffer is always orphaned when it wraps around instead.
+ */
+class stream_buffer {
+public:
+    /**
+     * \brief Constructor.
+     * \param capacity The maximum number of vertices in the buffer
+     * \note The capacity must be a multiple of 4.
+     */
+    explicit stream_buffer(std::size_t capacity);
+
+    /// Destructor.
+    ~stream_buffer();
+
+    // Non-copiable, non-movable
+    stream_buffer(const stream_buffer&)            = delete;
+    stream_buffer(stream_buffer&&)                 = delete;
+    stream_buffer& operator=(const stream_buffer&) = delete;
+    stream_buffer& operator=(stream_buffer&&)      = delete;
+
+    /**
+     * \brief Returns the maximum number of vertices in the buffer.
+     * \return The maximum number of vertices in the buffer
+     * \note Batches larger than this cannot be rendered with this buffer.
+     */
+    std::size_t get_capacity() const;
+
+    /**
+     * \brief Enables or disables the packed vertex layout.
+     * \param enabled 'true' to enable, 'false' to disable
+     * \note See vertex_cache::set_packed_vertex_enabled().
+     */
+    void set_packed_vertex_enabled(bool enabled);
+
+    /**
+     * \brief Checks if the packed vertex layout is enabled.
+     * \return 'true' if enabled, 'false' otherwise
+     */
+    bool is_packed_vertex_enabled() const;
+
+    /**
+     * \brief Appends quads to the buffer and renders them.
+     * \param vertex_data The vertices to render, four per quad
+     * \param num_vertex The number of vertices to render
+     * \note This does not bind the material, just renders the quads with whatever
+     * shader / texture is currently bound. The number of vertices must be a multiple
+     * of 4, and cannot exceed get_capacity().
+     */
+    void render_quads(const vertex* vertex_data, std::size_t num_vertex);
+
+    /**
+     * \brief Appends quad instances to the buffer and renders them.
+     * \param instance_data The quads to render
+     * \param num_instance The number of quads to render
+     * \note This does not bind the material, just renders the quads with whatever
+     * shader / texture is currently bound; the shader must be set up for instanced quads.
+     * The total size of the instances cannot exceed the size of get_capacity() vertices.
+     */
+    void render_quad_instances(const quad_instance* instance_data, std::size_t num_instance);
+
+    /**
+     * \brief Appends quads using several textures to the buffer and renders them.
+     * \param vertex_data The vertices to render, four per quad
+     * \param slot_data The texture slot of each vertex
+     * \param tile_data The tiling region of each vertex, or null if no quad is tiled
+     * \param num_vertex The number of vertices to render
+     * \note This does not bind the materials, just renders the quads with whatever
+     * shader / textures are currently bound. The texture slot is sent to the shader as an
+     * extra vertex attribute (see texture_slot_attribute), and so is the tiling region
+     * (see tile_rect_attribute). The number of vertices must be a multiple of 4, and the
+     * vertices and extra attributes must fit in get_capacity() vertices.
+     */
+    void render_multi_texture_quads(
+        const vertex*   vertex_data,
+        const float*    slot_data,
+        const bounds2f* tile_data,
+        std::size_t     num_vertex);
+
+    /**
+     * \brief Appends tiled quads to the buffer and renders them.
+     * \param vertex_data The vertices to render, four per quad
+     * \param tile_data The tiling region of each vertex
+     * \param num_vertex The number of vertices to render
+     * \note This does not bind the material, just renders the quads with whatever
+     * shader / texture is currently bound. The tiling region is sent to the shader as an
+     * extra vertex attribute (see tile_rect_attribute). The number of vertices must be a
+     * multiple of 4, and the vertices and tiling regions must fit in get_capacity() vertices.
+     */
+    void render_tiled_quads(
+        const vertex* vertex_data, const bounds2f* tile_data, std::size_t num_vertex);
+
+    /**
+     * \brief Marks the end of a render pass.
+     * \details This inserts a fence in the command stream, so that the regions of the
+     * buffer used so far can be safely overwritten once the GPU has reached this point.
+     */
+    void fence();
+
+private:
+    struct fence_info {
+        void*         sync     = nullptr;
+        std::uint64_t position = 0u;
+    };
+
+    std::size_t allocate_(std::size_t num_bytes);
+    void        wait_for_(std::uint64_t position);
+    void        write_(std::size_t offset, const void* data, std::size_t num_bytes);
+
+    void render_with_attributes_(
+        const vertex*   vertex_data,
+        const float*    slot_data,
+        const bounds2f* tile_data,
+        std::size_t     num_vertex);
+
+    std::size_t            capacity_           = 0u;
+    std::size_t            capacity_bytes_     = 0u;
+    std::uint64_t          position_           = 0u;
+    std::uint64_t          completed_position_ = 0u;
+    std::deque<fence_info> fence_list_;
+
+    std::uint32_t vertex_array_        = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t packed_vertex_array_ = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t instance_array_      = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t attribute_array_     = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t vertex_buffer_       = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t index_buffer_        = std::numeric_limits<std::uint32_t>::max();
+
+    bool packed_vertex_enabled_ = false;
+};
+
+} // namespace lxgui::gui::gl
+
+#endif
@@ -4,11 +4,96 @@
 #include "lxgui/gui_vertex_cache.hpp"
 #include "lxgui/utils.hpp"
 
+#include <array>
+#include <cstdint>
 #include <limits>
 #include <memory>
+#include <vector>
 
 namespace lxgui::gui::gl {
 
+/**
+ * \brief Compact vertex layout, used by vertex caches in packed vertex mode.
+ * \details This holds the same information as gui::vertex in 16 bytes instead of 32:
+ * texture coordinates are stored as 16-bit unsigned normalized integers, and the color
+ * as 8-bit unsigned normalized integers (not premultiplied, like gui::vertex).
+ * See vertex_cache::set_packed_vertex_enabled().
+ */
+struct packed_vertex {
+    vector2f                     pos;
+    std::array<std::uint16_t, 2> uvs;
+    std::array<std::uint8_t, 4>  col;
+};
+
+static_assert(sizeof(packed_vertex) == 16u, "packed_vertex must be 16 bytes");
+
+/**
+ * \brief Converts vertices to the compact packed_vertex layout.
+ * \param vertex_data The vertices to convert
+ * \param num_vertex The number of vertices to convert
+ * \param packed_data The array in which to store the converted vertices
+ * \return 'true' if all vertices could be converted, 'false' if some texture coordinates
+ * are outside of [0,1] (the content of packed_data is then unspecified)
+ */
+bool pack_vertices(
+    const vertex* vertex_data, std::size_t num_vertex, std::vector<packed_vertex>& packed_data);
+
+/**
+ * \brief Sets the vertex attributes of the currently bound vertex array.
+ * \param packed 'true' for the packed_vertex layout, 'false' for the vertex layout
+ * \param offset The offset of the first vertex in the currently bound vertex buffer (in bytes)
+ */
+void set_vertex_attributes(bool packed, std::size_t offset = 0u);
+
+/**
+ * \brief Instance record for an axis-aligned quad, used in instanced quad mode.
+ * \details This holds the same information as the four vertices of a quad whose edges
+ * are aligned with the axes, both in position and texture coordinates. The quad is
+ * expanded into two triangles in the vertex shader. The colors are stored as 8-bit
+ * unsigned normalized integers (not premultiplied, like gui::vertex), one per vertex.
+ * See vertex_cache::set_instanced_quads_enabled().
+ */
+struct quad_instance {
+    /// Position of the first vertex (x,y), and position of the third vertex (z,w)
+    std::array<float, 4> rect;
+    /// Texture coordinates of the first vertex (x,y), and of the third vertex (z,w)
+    std::array<float, 4> tex_rect;
+    /// Color of each vertex
+    std::array<color32, 4> col;
+};
+
+static_assert(sizeof(quad_instance) == 48u, "quad_instance must be 48 bytes");
+
+/**
+ * \brief Converts quad vertices to the quad_instance layout.
+ * \param vertex_data The vertices to convert, four per quad
+ * \param num_vertex The number of vertices to convert
+ * \param instance_data The array in which to store the converted quads
+ * \return 'true' if all quads could be converted, 'false' if some quads are not aligned
+ * with the axes (the content of instance_data is then unspecified)
+ */
+bool make_quad_instances(
+    const vertex* vertex_data, std::size_t num_vertex, std::vector<quad_instance>& instance_data);
+
+/**
+ * \brief Sets the instance attributes of the currently bound vertex array.
+ * \param offset The offset of the first instance in the currently bound vertex buffer (in bytes)
+ * \note The instance attributes must be enabled, with a divisor of one.
+ */
+void set_instance_attributes(std::size_t offset = 0u);
+
+/// Index of the first vertex attribute used by quad_instance.
+constexpr std::uint32_t first_instance_attribute = 3u;
+
+/// Number of vertex attributes used by quad_instance.
+constexpr std::uint32_t num_instance_attributes = 6u;
+
+/// Index of the vertex attribute holding the texture slot, for multi-texture batching.
+constexpr std::uint32_t texture_slot_attribute = 9u;
+
+/// Index of the vertex attribute holding the tiling region, for tiled quads.
+constexpr std::uint32_t tile_rect_attribute = 10u;
+
 /**
  * \brief An object representing cached vertex data on the GPU
  * \details A vertex cache stores vertices and indices that can be used to draw
@@ -73,6 +158,49 @@ public:
      */
     void update(const vertex* vertex_data, std::size_t num_vertex) override;
 
+    /**
+     * \brief Enables or disables the packed vertex layout.
+     * \param enabled 'true' to enable, 'false' to disable
+     * \details When enabled, vertices are converted to the compact packed_vertex layout
+     * when the data is updated, which halves the amount of memory sent to the GPU. This
+     * conversion is only possible if all the texture coordinates are within [0,1]; if not,
+     * the data is stored with the full vertex layout instead.
+     * \note This only affects the next update of the data. Disabled by default.
+     */
+    void set_packed_vertex_enabled(bool enabled);
+
+    /**
+     * \brief Checks if the packed vertex layout is enabled.
+     * \return 'true' if enabled, 'false' otherwise
+     */
+    bool is_packed_vertex_enabled() const;
+
+    /**
+     * \brief Enables or disables instanced quads.
+     * \param enabled 'true' to enable, 'false' to disable
+     * \details When enabled, update() stores quads as quad_instance records rather than four
+     * vertices each, and they are expanded into triangles in the vertex shader. This reduces
+     * the amount of memory sent to the GPU, and no index buffer is needed. This is only
+     * possible if all the quads are aligned with the axes (which is the case for text and
+     * most textures); if not, the data is stored as regular vertices instead.
+     * \note This only affects the next call to update() for caches of type QUADS.
+     * Disabled by default.
+     */
+    void set_instanced_quads_enabled(bool enabled);
+
+    /**
+     * \brief Checks if instanced quads are enabled.
+     * \return 'true' if enabled, 'false' otherwise
+     */
+    bool is_instanced_quads_enabled() const;
+
+    /**
+     * \brief Checks if the data currently stored in the cache is made of quad instances.
+     * \return 'true' if the cache stores quad_instance records, 'false' otherwise
+     * \note If 'true', the cache must be rendered with the instanced quad shader.
+     */
+    bool is_instanced() const;
+
     /**
      * \brief Renders the cache.
      * \note This does not bind the material, just binds the cache and renders it
@@ -81,13 +209,22 @@ public:
     void render() const;
 
 private:
+    enum class layout { vertex, packed_vertex, quad_instance };
+
+    void set_layout_(layout new_layout);
+    void upload_vertex_data_(const void* data, std::size_t num_bytes);
+
     std::size_t   current_size_vertex_     = 0u;
     std::size_t   current_size_index_      = 0u;
-    std::size_t   current_capacity_vertex_ = 0u;
+    std::size_t   current_size_instance_   = 0u;
+    std::size_t   current_capacity_bytes_  = 0u;
     std::size_t   current_capacity_index_  = 0u;
     std::uint32_t vertex_array_            = std::numeric_limits<std::uint32_t>::max();
     std::uint32_t vertex_buffer_           = std::numeric_limits<std::uint32_t>::max();
     std::uint32_t index_buffer_            = std::numeric_limits<std::uint32_t>::max();
+    bool          packed_vertex_enabled_   = false;
+    bool          instanced_quads_enabled_ = false;
+    layout        current_layout_          = layout::vertex;
 };
 
 } // namespace lxgui::gui::gl
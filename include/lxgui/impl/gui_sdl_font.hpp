@@ -1,6 +1,7 @@
 #ifndef LXGUI_GUI_SDL_FONT_HPP
 #define LXGUI_GUI_SDL_FONT_HPP
 
+#include "lxgui/gui_code_point_map.hpp"
 #include "lxgui/gui_font.hpp"
 #include "lxgui/impl/gui_sdl_material.hpp"
 #include "lxgui/utils.hpp"
@@ -74,6 +75,17 @@ public:
      */
     float get_character_height(char32_t c) const override;
 
+    /**
+     * \brief Returns the metrics of several characters at once.
+     * \param characters The unicode characters
+     * \param count The number of characters
+     * \param output The array that will receive the metrics (must have room for 'count' elements)
+     * \note This is equivalent to calling get_character_uvs(), get_character_bounds(), and
+     * get_character_width() for each character, but faster.
+     */
+    void get_character_metrics(
+        const char32_t* characters, std::size_t count, character_metrics* output) const override;
+
     /**
      * \brief Return the kerning amount between two characters.
      * \param c1 The first unicode character
@@ -118,6 +130,9 @@ private:
 
     std::shared_ptr<sdl::material> texture_;
     std::vector<range_info>        range_list_;
+
+    code_point_map<const character_info*> character_map_;
+    const character_info*                 default_character_ = nullptr;
 };
 
 } // namespace lxgui::gui::sdl
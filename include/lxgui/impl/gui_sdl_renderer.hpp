@@ -88,6 +88,12 @@ public:
     std::shared_ptr<gui::render_target> create_render_target(
         const vector2ui& dimensions, material::filter filt = material::filter::none) override;
 
+    /**
+     * \brief Checks if the renderer can clip rendering to a rectangle on the GPU.
+     * \return 'true' if clipping is done on the GPU, 'false' otherwise
+     */
+    bool is_scissor_supported() const override;
+
     /**
      * \brief Checks if the renderer supports vertex caches.
      * \return 'true' if supported, 'false' otherwise
@@ -175,6 +181,13 @@ protected:
      */
     void set_view_(const matrix4f& view_matrix) override;
 
+    /**
+     * \brief Restricts rendering to a rectangle on the GPU.
+     * \param rect The clipping rectangle, in screen-space coordinates (see set_view()),
+     * or nullptr to disable clipping
+     */
+    void set_scissor_(const bounds2f* rect) override;
+
     /**
      * \brief Renders a quad from a material and array of vertices.
      * \param mat The material to use to to render the quad, or null if none
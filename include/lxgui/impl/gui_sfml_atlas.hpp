@@ -31,6 +31,13 @@ protected:
     std::shared_ptr<gui::material>
     add_material_(const gui::material& mat, const bounds2f& location) override;
 
+    /**
+     * \brief Creates a material pointing to a portion of this page
+     * \param location The position of the material in this page
+     * \return A new material pointing to inside this page
+     */
+    std::shared_ptr<gui::material> create_material_(const bounds2f& location) const override;
+
     /**
      * \brief Return the width of this page (in pixels).
      * \return The width of this page (in pixels)
@@ -1,11 +1,13 @@
 #ifndef LXGUI_GUI_SFML_FONT_HPP
 #define LXGUI_GUI_SFML_FONT_HPP
 
+#include "lxgui/gui_code_point_map.hpp"
 #include "lxgui/gui_font.hpp"
 #include "lxgui/impl/gui_sfml_material.hpp"
 #include "lxgui/utils.hpp"
 
 #include <SFML/Graphics/Font.hpp>
+#include <unordered_map>
 #include <vector>
 
 namespace lxgui::gui::sfml {
@@ -68,6 +70,17 @@ public:
      */
     float get_character_height(char32_t c) const override;
 
+    /**
+     * \brief Returns the metrics of several characters at once.
+     * \param characters The unicode characters
+     * \param count The number of characters
+     * \param output The array that will receive the metrics (must have room for 'count' elements)
+     * \note This is equivalent to calling get_character_uvs(), get_character_bounds(), and
+     * get_character_width() for each character, but faster.
+     */
+    void get_character_metrics(
+        const char32_t* characters, std::size_t count, character_metrics* output) const override;
+
     /**
      * \brief Return the kerning amount between two characters.
      * \param c1 The first unicode character
@@ -93,7 +106,19 @@ public:
     void update_texture(std::shared_ptr<gui::material> mat) override;
 
 private:
-    char32_t get_character_(char32_t c) const;
+    struct character_info {
+        char32_t code_point = 0;
+        bounds2f uvs;
+        bounds2f rect;
+        float    advance = 0.0f;
+    };
+
+    struct range_info {
+        code_point_range            range;
+        std::vector<character_info> data;
+    };
+
+    const character_info* get_character_(char32_t c) const;
 
     sf::Font    font_;
     std::size_t size_               = 0u;
@@ -101,7 +126,12 @@ private:
     char32_t    default_code_point_ = 0u;
 
     std::shared_ptr<sfml::material> texture_;
-    std::vector<code_point_range>   code_points_;
+    std::vector<range_info>         range_list_;
+
+    code_point_map<const character_info*> character_map_;
+    const character_info*                 default_character_ = nullptr;
+
+    mutable std::unordered_map<std::uint64_t, float> kerning_cache_;
 };
 
 } // namespace lxgui::gui::sfml
@@ -4,18 +4,18 @@
 #include "lxgui/gui_vector2.hpp"
 #include "lxgui/input_keys.hpp"
 #include "lxgui/input_signals.hpp"
+#include "lxgui/input_source.hpp"
 #include "lxgui/lxgui.hpp"
 #include "lxgui/utils_signal.hpp"
 
 #include <array>
 #include <chrono>
 #include <string>
+#include <variant>
 #include <vector>
 
 namespace lxgui::input {
 
-class source;
-
 /**
  * \brief Handles inputs (keyboard and mouse)
  * \details The implementation is responsible for generating the
@@ -42,6 +42,14 @@ class source;
  * if a particular event is allowed to propagate to the elements below
  * the UI. If you need to react only to events that are not captured by
  * the UI, use events from @ref input::world_dispatcher instead.
+ *
+ * By default, events are forwarded as soon as they are received from the
+ * @ref input::source. In buffered mode (see set_buffered()), events are
+ * instead stored in a queue, and only forwarded when process_events() is
+ * called (this is done by gui::manager::update_ui()). The state queries
+ * (key_is_down(), mouse_is_down(), get_mouse_position(), ...) then describe
+ * the state reached by the events forwarded so far, rather than the live
+ * state of the source, so they stay consistent with the events.
  */
 class dispatcher : public signals {
 public:
@@ -147,6 +155,33 @@ public:
      */
     float get_interface_scaling_factor() const;
 
+    /**
+     * \brief Enables or disables buffered input.
+     * \param buffered 'true' to enable buffered input, 'false' to disable it (default)
+     * \details In buffered mode, events received from the input source are stored in a queue
+     * instead of being forwarded immediately. The queue is emptied by process_events(),
+     * which forwards all events in the order they were received. Consecutive mouse motion
+     * events are merged into a single event, which reduces the amount of work done by the
+     * UI when the mouse has a high polling rate.
+     * \note When buffered input is disabled, any event remaining in the queue is forwarded
+     * immediately.
+     */
+    void set_buffered(bool buffered);
+
+    /**
+     * \brief Checks if buffered input is enabled.
+     * \return 'true' if buffered input is enabled
+     * \see set_buffered()
+     */
+    bool is_buffered() const;
+
+    /**
+     * \brief Forwards all the events stored in the queue (in buffered mode).
+     * \note This does nothing if buffered input is disabled.
+     * \see set_buffered()
+     */
+    void process_events();
+
     /**
      * \brief Returns the input source.
      * \return The input source
@@ -165,9 +200,46 @@ private:
     using timer      = std::chrono::high_resolution_clock;
     using time_point = timer::time_point;
 
+    /// Event received from the input source (in pixels, before scaling).
+    using event_data = std::variant<
+        key_pressed_data,
+        key_pressed_repeat_data,
+        key_released_data,
+        text_entered_data,
+        mouse_pressed_data,
+        mouse_released_data,
+        mouse_wheel_data,
+        mouse_moved_data>;
+
+    struct queued_event {
+        event_data data;
+        time_point time;
+    };
+
+    void on_source_event_(event_data data);
+
+    void process_event_(const key_pressed_data& data, time_point time);
+    void process_event_(const key_pressed_repeat_data& data, time_point time);
+    void process_event_(const key_released_data& data, time_point time);
+    void process_event_(const text_entered_data& data, time_point time);
+    void process_event_(const mouse_pressed_data& data, time_point time);
+    void process_event_(const mouse_released_data& data, time_point time);
+    void process_event_(const mouse_wheel_data& data, time_point time);
+    void process_event_(const mouse_moved_data& data, time_point time);
+
+    const source::key_state&   get_key_state_() const;
+    const source::mouse_state& get_mouse_state_() const;
+
     std::array<time_point, key_number>          key_pressed_time_   = {};
     std::array<time_point, mouse_button_number> mouse_pressed_time_ = {};
 
+    // State reached by the forwarded events (in buffered mode, lags behind the source)
+    source::key_state   key_state_;
+    source::mouse_state mouse_state_;
+
+    bool                      is_buffered_ = false;
+    std::vector<queued_event> event_queue_;
+
     float scaling_factor_ = 1.0f;
 
     double double_click_time_ = 0.25;
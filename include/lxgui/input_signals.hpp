@@ -3,7 +3,7 @@
 
 #include "lxgui/gui_vector2.hpp"
 #include "lxgui/lxgui.hpp"
-#include "lxgui/utils_signal.hpp"
+#include "lxgui/utils_light_signal.hpp"
 
 namespace lxgui::input {
 
@@ -87,58 +87,58 @@ public:
     /**
      * \brief Signal triggered when the mouse moves
      */
-    utils::signal<void(const mouse_moved_data&)> on_mouse_moved;
+    utils::light_signal<void(const mouse_moved_data&)> on_mouse_moved;
 
     /**
      * \brief Signal triggered when the mouse wheel is moved
      */
-    utils::signal<void(const mouse_wheel_data&)> on_mouse_wheel;
+    utils::light_signal<void(const mouse_wheel_data&)> on_mouse_wheel;
 
     /**
      * \brief Signal triggered when a mouse button is pressed
      */
-    utils::signal<void(const mouse_pressed_data&)> on_mouse_pressed;
+    utils::light_signal<void(const mouse_pressed_data&)> on_mouse_pressed;
 
     /**
      * \brief Signal triggered when a mouse button is released
      */
-    utils::signal<void(const mouse_released_data&)> on_mouse_released;
+    utils::light_signal<void(const mouse_released_data&)> on_mouse_released;
 
     /**
      * \brief Signal triggered when a mouse button is double clicked
      */
-    utils::signal<void(const mouse_double_clicked_data&)> on_mouse_double_clicked;
+    utils::light_signal<void(const mouse_double_clicked_data&)> on_mouse_double_clicked;
 
     /**
      * \brief Signal triggered when the mouse starts a drag operation
      */
-    utils::signal<void(const mouse_drag_start_data&)> on_mouse_drag_start;
+    utils::light_signal<void(const mouse_drag_start_data&)> on_mouse_drag_start;
 
     /**
      * \brief Signal triggered when the mouse ends a drag operation
      */
-    utils::signal<void(const mouse_drag_stop_data&)> on_mouse_drag_stop;
+    utils::light_signal<void(const mouse_drag_stop_data&)> on_mouse_drag_stop;
 
     /**
      * \brief Signal triggered when a keyboard key is pressed
      */
-    utils::signal<void(const key_pressed_data&)> on_key_pressed;
+    utils::light_signal<void(const key_pressed_data&)> on_key_pressed;
 
     /**
      * \brief Signal triggered when a keyboard key is long-pressed and repeats
      */
-    utils::signal<void(const key_pressed_repeat_data&)> on_key_pressed_repeat;
+    utils::light_signal<void(const key_pressed_repeat_data&)> on_key_pressed_repeat;
 
     /**
      * \brief Signal triggered when a keyboard key is released
      */
-    utils::signal<void(const key_released_data&)> on_key_released;
+    utils::light_signal<void(const key_released_data&)> on_key_released;
 
     /**
      * \brief Signal triggered when text is entered
      * \note The event will trigger repeatedly if more than one character is generated.
      */
-    utils::signal<void(const text_entered_data&)> on_text_entered;
+    utils::light_signal<void(const text_entered_data&)> on_text_entered;
 };
 
 } // namespace lxgui::input
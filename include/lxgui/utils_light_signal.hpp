@@ -0,0 +1,267 @@
+#ifndef LXGUI_UTILS_LIGHT_SIGNAL_HPP
+#define LXGUI_UTILS_LIGHT_SIGNAL_HPP
+
+#include "lxgui/lxgui.hpp"
+#include "lxgui/utils.hpp"
+#include "lxgui/utils_signal.hpp"
+#include "lxgui/utils_small_function.hpp"
+#include "lxgui/utils_view.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace lxgui::utils {
+
+/**
+ * \brief Single-threaded signal, with the same interface and guarantees as @ref signal.
+ * \details This signal is optimized for being triggered frequently, at the expense of
+ * being usable from a single thread only:
+ *  - Slots are stored by value, contiguously, and their callables are stored in a
+ *  @ref small_function, so triggering the signal does not follow any pointer, and
+ *  connecting a typical slot does not allocate (beyond the growth of the slot list).
+ *  - The slot list is protected against the destruction of the signal during a trigger
+ *  with a non-atomic reference count, instead of a std::shared_ptr.
+ *  - Disconnected slots are only flagged as such. They are removed in bulk, once it is
+ *  safe to do so, and only if at least one slot was disconnected since the last clean up.
+ *
+ * Connections are represented by the same @ref connection class as for @ref signal, and
+ * can be wrapped in a @ref scoped_connection.
+ *
+ * The same behaviors as @ref signal are guaranteed: connecting or disconnecting slots from
+ * any slot, destroying the signal from any slot, and calling the signal recursively are
+ * safe. Slots are called in order of connection, and slots connected while the signal is
+ * being triggered will not be called until the next trigger of the signal.
+ *
+ * \warning Neither the signal nor its connections can be used from multiple threads.
+ */
+template<typename T>
+class light_signal {
+public:
+    /// Type of the callable function stored in a slot.
+    using function_type = small_function<T>;
+
+private:
+    struct slot {
+        std::size_t   id           = 0u;
+        bool          disconnected = false;
+        function_type callback;
+    };
+
+    /**
+     * \brief Type of the slot list.
+     * Slots are stored by value. Slots are only added or removed when the signal is not
+     * being triggered, hence references to slots remain valid while calling them.
+     * Slot identifiers are strictly increasing, and the order of slots is preserved,
+     * so a slot can be found from its identifier with a binary search.
+     */
+    using slot_list = std::vector<slot>;
+
+    /// De-reference an iterator from the slot list to get to the function.
+    template<typename BaseIterator>
+    struct slot_dereferencer {
+        using data_type = const function_type&;
+        static data_type dereference(const BaseIterator& iter) noexcept {
+            return iter->callback;
+        }
+    };
+
+    /// Filter out the disconnected slots from the slot list.
+    template<typename BaseIterator>
+    struct non_disconnected_filter {
+        static bool is_included(const BaseIterator& iter) noexcept {
+            return !iter->disconnected;
+        }
+    };
+
+    struct storage final : signal_impl::slot_storage_base {
+        slot_list   slots;
+        slot_list   pending_slots; // Slots connected while the signal is triggered
+        std::size_t next_id          = 0u;
+        std::size_t recursion        = 0u;
+        bool        has_disconnected = false;
+
+        template<typename Self>
+        static auto* find_slot(Self& self, std::size_t id) noexcept {
+            for (auto* list : {&self.slots, &self.pending_slots}) {
+                auto iter = std::lower_bound(
+                    list->begin(), list->end(), id,
+                    [](const slot& slt, std::size_t value) { return slt.id < value; });
+
+                if (iter != list->end() && iter->id == id)
+                    return &*iter;
+            }
+
+            return static_cast<decltype(&*self.slots.begin())>(nullptr);
+        }
+
+        void disconnect_slot(std::size_t id) noexcept override {
+            if (auto* slt = find_slot(*this, id)) {
+                slt->disconnected = true;
+                has_disconnected  = true;
+            }
+        }
+
+        [[nodiscard]] bool is_slot_connected(std::size_t id) const noexcept override {
+            const auto* slt = find_slot(*this, id);
+            return slt && !slt->disconnected;
+        }
+
+        void garbage_collect() {
+            if (!pending_slots.empty()) {
+                slots.insert(
+                    slots.end(), std::make_move_iterator(pending_slots.begin()),
+                    std::make_move_iterator(pending_slots.end()));
+                pending_slots.clear();
+            }
+
+            if (has_disconnected) {
+                auto iter = std::remove_if(
+                    slots.begin(), slots.end(), [](const auto& slt) { return slt.disconnected; });
+
+                slots.erase(iter, slots.end());
+                has_disconnected = false;
+            }
+        }
+    };
+
+    /// Marks the signal as being triggered, for the lifetime of this object.
+    struct call_scope {
+        explicit call_scope(storage& s) noexcept : impl(s) {
+            ++impl.recursion;
+        }
+
+        ~call_scope() {
+            if (--impl.recursion == 0u)
+                impl.garbage_collect();
+        }
+
+        call_scope(const call_scope&) = delete;
+        call_scope(call_scope&&)      = delete;
+        call_scope& operator=(const call_scope&) = delete;
+        call_scope& operator=(call_scope&&) = delete;
+
+        storage& impl;
+    };
+
+public:
+    /// Type of the view returned by slots().
+    using slot_list_view =
+        utils::view::adaptor<slot_list, slot_dereferencer, non_disconnected_filter>;
+
+    /// Default constructor (no slot).
+    light_signal() : storage_(new storage) {}
+
+    /// Destructor.
+    ~light_signal() {
+        // Mark all slots as disconnected, in case the destructor
+        // is called midway through the signal being emitted.
+        if (storage_.get())
+            disconnect_all();
+    }
+
+    // Non-copiable, movable.
+    light_signal(const light_signal&) = delete;
+    light_signal(light_signal&&)      = default;
+    light_signal& operator=(const light_signal&) = delete;
+    light_signal& operator=(light_signal&&) = default;
+
+    /// Disconnects all slots.
+    void disconnect_all() noexcept {
+        auto& impl = get_storage_();
+        if (impl.recursion == 0u) {
+            impl.slots.clear();
+            impl.pending_slots.clear();
+            impl.has_disconnected = false;
+            return;
+        }
+
+        // We are in the middle of an iteration; just mark slots as disconnected.
+        // They will be removed when the signal is no longer being iterated on.
+        for (auto* list : {&impl.slots, &impl.pending_slots}) {
+            for (auto& slt : *list)
+                slt.disconnected = true;
+        }
+
+        impl.has_disconnected = true;
+    }
+
+    /**
+     * \brief Check if this signal contains any slot.
+     * \return 'true' if at least one slot is connected.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        const auto& impl         = get_storage_();
+        const auto  is_connected = [](const auto& slt) { return !slt.disconnected; };
+        return std::none_of(impl.slots.begin(), impl.slots.end(), is_connected) &&
+               std::none_of(impl.pending_slots.begin(), impl.pending_slots.end(), is_connected);
+    }
+
+    /**
+     * \brief Return a constant view onto the connected slots.
+     * \return A constant view onto the connected slots
+     * \warning Do not attempt to connect or disconnect slots while iterating over this view.
+     * Slots connected while the signal is being triggered are not included until the
+     * trigger is over.
+     */
+    [[nodiscard]] slot_list_view slots() const noexcept {
+        return slot_list_view(get_storage_().slots);
+    }
+
+    /**
+     * \brief Connect a new slot to this signal.
+     * \param function The function to store in the slot.
+     * \return A connection object, which can be used to disconnect the slot at any time.
+     * \note See signal::connect() for more information.
+     */
+    connection connect(function_type function) {
+        auto&             impl = get_storage_();
+        const std::size_t id   = impl.next_id++;
+
+        if (impl.recursion == 0u) {
+            impl.garbage_collect();
+            impl.slots.push_back(slot{id, false, std::move(function)});
+        } else {
+            // Adding to the slot list now could move the slot being called
+            impl.pending_slots.push_back(slot{id, false, std::move(function)});
+        }
+
+        return connection(storage_, id);
+    }
+
+    /**
+     * \brief Trigger the signal.
+     * \param args Arguments to forward to all the connected slots.
+     */
+    template<typename... Args>
+    void operator()(Args&&... args) {
+        // Keep the slot list alive, even if this signal is destroyed midway during a slot.
+        // To support this, we must not use any member variable or member function of the
+        // signal object, which may be destroyed at any time.
+        const signal_impl::slot_storage_ptr guard = storage_;
+        auto&                               impl  = static_cast<storage&>(*guard.get());
+
+        call_scope scope(impl);
+
+        // Call the slots
+        // NB: Cache the size here, so new slots connected will not trigger
+        const std::size_t num_slots = impl.slots.size();
+        for (std::size_t i = 0; i < num_slots; ++i) {
+            auto& slt = impl.slots[i];
+            if (!slt.disconnected)
+                slt.callback(args...);
+        }
+    }
+
+private:
+    storage& get_storage_() const noexcept {
+        return static_cast<storage&>(*storage_.get());
+    }
+
+    signal_impl::slot_storage_ptr storage_;
+};
+
+} // namespace lxgui::utils
+
+#endif
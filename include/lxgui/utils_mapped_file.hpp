@@ -0,0 +1,54 @@
+#ifndef LXGUI_UTILS_MAPPED_FILE_HPP
+#define LXGUI_UTILS_MAPPED_FILE_HPP
+
+#include "lxgui/lxgui.hpp"
+#include "lxgui/utils.hpp"
+
+#include <cstddef>
+#include <string>
+
+namespace lxgui::utils {
+
+/**
+ * \brief A read-only file mapped in memory.
+ * \details The content of the file is accessed directly through the mapping, without
+ * copying it into a user-space buffer; pages are only read from disk when first accessed.
+ */
+class mapped_file {
+public:
+    /**
+     * \brief Maps a file in memory.
+     * \param file_name The name of the file to map
+     * \note Throws a utils::exception if the file cannot be opened or mapped.
+     */
+    explicit mapped_file(const std::string& file_name);
+
+    /// Destructor, un-maps the file.
+    ~mapped_file();
+
+    // Non-copiable, non-movable
+    mapped_file(const mapped_file&) = delete;
+    mapped_file(mapped_file&&)      = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+    mapped_file& operator=(mapped_file&&) = delete;
+
+    /**
+     * \brief Returns the content of the file.
+     * \return The content of the file
+     */
+    const std::byte* get_data() const;
+
+    /**
+     * \brief Returns the size of the file, in bytes.
+     * \return The size of the file, in bytes
+     */
+    std::size_t get_size() const;
+
+private:
+    const std::byte* data_ = nullptr;
+    std::size_t      size_ = 0u;
+};
+
+} // namespace lxgui::utils
+
+#endif
@@ -0,0 +1,205 @@
+#ifndef LXGUI_UTILS_MEMORY_POOL_HPP
+#define LXGUI_UTILS_MEMORY_POOL_HPP
+
+#include "lxgui/lxgui.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace lxgui::utils {
+
+/**
+ * \brief Allocates blocks of fixed size, in large chunks.
+ * \details Memory is requested from the system in chunks holding a fixed number of
+ * blocks. Blocks that are de-allocated are kept in a list of free blocks, and re-used
+ * by the next allocations. This makes allocating and de-allocating blocks very cheap,
+ * and keeps objects allocated together close to each other in memory. Memory is only
+ * returned to the system when calling release(), or when the pool is destroyed.
+ * \note This class is not thread-safe.
+ */
+class memory_pool {
+public:
+    /**
+     * \brief Constructor.
+     * \param block_size The size of each block (in bytes)
+     * \param blocks_per_chunk The number of blocks to allocate at once
+     */
+    explicit memory_pool(std::size_t block_size, std::size_t blocks_per_chunk = 256u);
+
+    // Non-copiable, non-movable
+    memory_pool(const memory_pool&)            = delete;
+    memory_pool(memory_pool&&)                 = delete;
+    memory_pool& operator=(const memory_pool&) = delete;
+    memory_pool& operator=(memory_pool&&)      = delete;
+
+    /**
+     * \brief Allocates a new block.
+     * \return A pointer to the new block, aligned to std::max_align_t
+     */
+    void* allocate();
+
+    /**
+     * \brief Returns a block to the pool.
+     * \param ptr The block to return, which must have been allocated by this pool
+     */
+    void deallocate(void* ptr) noexcept;
+
+    /**
+     * \brief Returns all the memory allocated by this pool to the system.
+     * \return 'true' if the memory was released, 'false' if some blocks are still in use
+     * \note If some blocks are still in use, nothing is released.
+     */
+    bool release() noexcept;
+
+    /**
+     * \brief Returns the size of each block.
+     * \return The size of each block (in bytes)
+     */
+    std::size_t get_block_size() const;
+
+    /**
+     * \brief Returns the number of blocks currently in use.
+     * \return The number of blocks currently in use
+     */
+    std::size_t get_used_block_count() const;
+
+    /**
+     * \brief Returns the total memory allocated by this pool.
+     * \return The total memory allocated by this pool (in bytes)
+     */
+    std::size_t get_allocated_size() const;
+
+private:
+    struct free_block {
+        free_block* next = nullptr;
+    };
+
+    std::size_t block_size_       = 0u;
+    std::size_t blocks_per_chunk_ = 0u;
+    std::size_t used_block_count_ = 0u;
+
+    std::vector<std::unique_ptr<std::byte[]>> chunk_list_;
+    free_block*                               free_list_ = nullptr;
+};
+
+/**
+ * \brief Set of memory pools for small allocations of various sizes.
+ * \details Allocations are rounded up to the next size class, and served by the pool for
+ * that size. Allocations that are too large, or with a stronger alignment requirement than
+ * std::max_align_t, are forwarded to the global operator new.
+ * \note This class is not thread-safe.
+ */
+class memory_arena {
+public:
+    /// Granularity of the size classes (in bytes).
+    static constexpr std::size_t size_class_step = alignof(std::max_align_t);
+    /// Number of size classes; larger allocations are not pooled.
+    static constexpr std::size_t num_size_classes = 16u;
+    /// Largest allocation served by the pools (in bytes).
+    static constexpr std::size_t max_pooled_size = size_class_step * num_size_classes;
+
+    /// Default constructor.
+    memory_arena() = default;
+
+    // Non-copiable, non-movable
+    memory_arena(const memory_arena&)            = delete;
+    memory_arena(memory_arena&&)                 = delete;
+    memory_arena& operator=(const memory_arena&) = delete;
+    memory_arena& operator=(memory_arena&&)      = delete;
+
+    /**
+     * \brief Allocates memory.
+     * \param size The number of bytes to allocate
+     * \param alignment The required alignment
+     * \return A pointer to the allocated memory
+     */
+    void* allocate(std::size_t size, std::size_t alignment);
+
+    /**
+     * \brief Returns memory to the arena.
+     * \param ptr The memory to return, which must have been allocated by this arena
+     * \param size The number of bytes that were allocated
+     * \param alignment The alignment that was requested
+     */
+    void deallocate(void* ptr, std::size_t size, std::size_t alignment) noexcept;
+
+    /**
+     * \brief Returns all the memory held by unused pools to the system.
+     * \return 'true' if all the memory was released, 'false' if some memory is still in use
+     */
+    bool release() noexcept;
+
+    /**
+     * \brief Returns the total memory allocated by the pools of this arena.
+     * \return The total memory allocated by the pools of this arena (in bytes)
+     */
+    std::size_t get_allocated_size() const;
+
+private:
+    static bool is_pooled_(std::size_t size, std::size_t alignment) {
+        return size != 0u && size <= max_pooled_size && alignment <= size_class_step;
+    }
+
+    memory_pool& get_pool_(std::size_t size);
+
+    std::array<std::unique_ptr<memory_pool>, num_size_classes> pool_list_;
+};
+
+/**
+ * \brief Standard allocator drawing memory from a memory_arena.
+ * \details If no arena is provided, memory is allocated with the global operator new.
+ */
+template<typename T>
+class arena_allocator {
+public:
+    using value_type = T;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+
+    arena_allocator() noexcept = default;
+
+    explicit arena_allocator(memory_arena& arena) noexcept : arena_(&arena) {}
+
+    template<typename U>
+    arena_allocator(const arena_allocator<U>& other) noexcept : arena_(other.get_arena()) {}
+
+    T* allocate(std::size_t n) {
+        if (arena_)
+            return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+        else
+            return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* ptr, std::size_t n) noexcept {
+        if (arena_)
+            arena_->deallocate(ptr, n * sizeof(T), alignof(T));
+        else
+            std::allocator<T>{}.deallocate(ptr, n);
+    }
+
+    memory_arena* get_arena() const noexcept {
+        return arena_;
+    }
+
+    template<typename U>
+    bool operator==(const arena_allocator<U>& other) const noexcept {
+        return arena_ == other.get_arena();
+    }
+
+    template<typename U>
+    bool operator!=(const arena_allocator<U>& other) const noexcept {
+        return arena_ != other.get_arena();
+    }
+
+private:
+    memory_arena* arena_ = nullptr;
+};
+
+} // namespace lxgui::utils
+
+#endif
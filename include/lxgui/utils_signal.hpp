@@ -6,8 +6,10 @@
 #include "lxgui/utils_view.hpp"
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace lxgui::utils {
@@ -20,6 +22,63 @@ struct slot_base {
     bool disconnected = false;
 };
 
+/**
+ * \brief Base class for the slot storage of signals storing slots by value (light_signal).
+ * \details Such slots cannot be observed individually; a connection refers to the storage,
+ * and to the identifier of the slot within it. The storage is reference counted (without
+ * atomic operations, so it must only be used from one thread), and stays alive as long as
+ * the signal, one of its connections, or an ongoing call of the signal is alive.
+ */
+struct slot_storage_base {
+    std::size_t ref_count = 0u;
+
+    virtual ~slot_storage_base() = default;
+
+    virtual void               disconnect_slot(std::size_t id) noexcept         = 0;
+    [[nodiscard]] virtual bool is_slot_connected(std::size_t id) const noexcept = 0;
+};
+
+/// Non-atomic intrusive pointer to a slot_storage_base.
+class slot_storage_ptr {
+public:
+    slot_storage_ptr() noexcept = default;
+
+    explicit slot_storage_ptr(slot_storage_base* storage) noexcept : storage_(storage) {
+        if (storage_)
+            ++storage_->ref_count;
+    }
+
+    slot_storage_ptr(const slot_storage_ptr& other) noexcept :
+        slot_storage_ptr(other.storage_) {}
+
+    slot_storage_ptr(slot_storage_ptr&& other) noexcept : storage_(other.storage_) {
+        other.storage_ = nullptr;
+    }
+
+    slot_storage_ptr& operator=(const slot_storage_ptr& other) noexcept {
+        slot_storage_ptr copy(other);
+        std::swap(storage_, copy.storage_);
+        return *this;
+    }
+
+    slot_storage_ptr& operator=(slot_storage_ptr&& other) noexcept {
+        std::swap(storage_, other.storage_);
+        return *this;
+    }
+
+    ~slot_storage_ptr() {
+        if (storage_ && --storage_->ref_count == 0u)
+            delete storage_;
+    }
+
+    slot_storage_base* get() const noexcept {
+        return storage_;
+    }
+
+private:
+    slot_storage_base* storage_ = nullptr;
+};
+
 } // namespace signal_impl
 /** \endcond
  */
@@ -28,10 +87,15 @@ struct slot_base {
 class connection {
     template<typename T>
     friend class signal;
+    template<typename T>
+    friend class light_signal;
 
     explicit connection(utils::observer_ptr<signal_impl::slot_base> slot) noexcept :
         slot_(std::move(slot)) {}
 
+    explicit connection(signal_impl::slot_storage_ptr storage, std::size_t id) noexcept :
+        storage_(std::move(storage)), id_(id) {}
+
 public:
     /// Default constructor, no connection.
     connection() = default;
@@ -47,6 +111,9 @@ public:
         if (auto* raw = slot_.get()) {
             raw->disconnected = true;
             slot_             = nullptr;
+        } else if (auto* storage = storage_.get()) {
+            storage->disconnect_slot(id_);
+            storage_ = signal_impl::slot_storage_ptr{};
         }
     }
 
@@ -54,12 +121,16 @@ public:
     [[nodiscard]] bool connected() const noexcept {
         if (auto* raw = slot_.get())
             return !raw->disconnected;
+        else if (auto* storage = storage_.get())
+            return storage->is_slot_connected(id_);
         else
             return false;
     }
 
 private:
     utils::observer_ptr<signal_impl::slot_base> slot_;
+    signal_impl::slot_storage_ptr               storage_;
+    std::size_t                                 id_ = 0u;
 };
 
 /// A @ref connection that automatically disconnects when going out of scope.
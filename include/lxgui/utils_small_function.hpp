@@ -0,0 +1,208 @@
+#ifndef LXGUI_UTILS_SMALL_FUNCTION_HPP
+#define LXGUI_UTILS_SMALL_FUNCTION_HPP
+
+#include "lxgui/lxgui.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace lxgui::utils {
+
+template<typename Signature, std::size_t BufferSize = 6 * sizeof(void*)>
+class small_function;
+
+/**
+ * \brief A copiable type-erased callable, similar to std::function.
+ * \details Callables which are small enough (up to BufferSize bytes), and which can be moved
+ * without throwing, are stored inline, without any memory allocation. Larger callables are
+ * allocated on the heap. Unlike std::function, the size of the inline buffer is known and
+ * can be configured, so that it can hold the typical lambda capturing a few pointers, a
+ * std::string, or a std::shared_ptr.
+ * \note Like std::function, the stored callable is always called as non-const.
+ */
+template<typename R, typename... Args, std::size_t BufferSize>
+class small_function<R(Args...), BufferSize> {
+    static_assert(BufferSize >= sizeof(void*), "buffer must be able to hold a pointer");
+
+    struct vtable {
+        R (*invoke)(void* storage, Args... args);
+        void (*copy)(const void* from, void* to);
+        void (*move)(void* from, void* to) noexcept;
+        void (*destroy)(void* storage) noexcept;
+    };
+
+    template<typename F>
+    static constexpr bool is_inline = sizeof(F) <= BufferSize &&
+                                      alignof(F) <= alignof(std::max_align_t) &&
+                                      std::is_nothrow_move_constructible_v<F>;
+
+    template<typename F>
+    struct inline_model {
+        static F& get(void* storage) noexcept {
+            return *std::launder(static_cast<F*>(storage));
+        }
+
+        static const F& get(const void* storage) noexcept {
+            return *std::launder(static_cast<const F*>(storage));
+        }
+
+        static R invoke(void* storage, Args... args) {
+            return std::invoke(get(storage), std::forward<Args>(args)...);
+        }
+
+        static void copy(const void* from, void* to) {
+            new (to) F(get(from));
+        }
+
+        static void move(void* from, void* to) noexcept {
+            new (to) F(std::move(get(from)));
+            get(from).~F();
+        }
+
+        static void destroy(void* storage) noexcept {
+            get(storage).~F();
+        }
+
+        static constexpr vtable table = {&invoke, &copy, &move, &destroy};
+    };
+
+    template<typename F>
+    struct heap_model {
+        static F*& get(void* storage) noexcept {
+            return *std::launder(static_cast<F**>(storage));
+        }
+
+        static F* get(const void* storage) noexcept {
+            return *std::launder(static_cast<F* const*>(storage));
+        }
+
+        static R invoke(void* storage, Args... args) {
+            return std::invoke(*get(storage), std::forward<Args>(args)...);
+        }
+
+        static void copy(const void* from, void* to) {
+            new (to) F*(new F(*get(from)));
+        }
+
+        static void move(void* from, void* to) noexcept {
+            new (to) F*(get(from));
+        }
+
+        static void destroy(void* storage) noexcept {
+            delete get(storage);
+        }
+
+        static constexpr vtable table = {&invoke, &copy, &move, &destroy};
+    };
+
+public:
+    /// Default constructor, empty function.
+    small_function() noexcept = default;
+
+    /// Conversion from nullptr, empty function.
+    small_function(std::nullptr_t) noexcept {}
+
+    /**
+     * \brief Constructor from a callable.
+     * \param func The callable to store
+     */
+    template<
+        typename F,
+        typename Enable = std::enable_if_t<
+            !std::is_same_v<std::decay_t<F>, small_function> &&
+            std::is_invocable_r_v<R, std::decay_t<F>&, Args...>>>
+    small_function(F&& func) {
+        using stored_type = std::decay_t<F>;
+
+        if constexpr (is_inline<stored_type>) {
+            new (storage_) stored_type(std::forward<F>(func));
+            vtable_ = &inline_model<stored_type>::table;
+        } else {
+            new (storage_) stored_type*(new stored_type(std::forward<F>(func)));
+            vtable_ = &heap_model<stored_type>::table;
+        }
+    }
+
+    /// Copy constructor.
+    small_function(const small_function& other) : vtable_(other.vtable_) {
+        if (vtable_)
+            vtable_->copy(other.storage_, storage_);
+    }
+
+    /// Move constructor.
+    small_function(small_function&& other) noexcept : vtable_(other.vtable_) {
+        if (vtable_) {
+            vtable_->move(other.storage_, storage_);
+            other.vtable_ = nullptr;
+        }
+    }
+
+    /// Copy assignment.
+    small_function& operator=(const small_function& other) {
+        if (this != &other) {
+            small_function copy(other);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    /// Move assignment.
+    small_function& operator=(small_function&& other) noexcept {
+        if (this != &other) {
+            reset_();
+
+            vtable_ = other.vtable_;
+            if (vtable_) {
+                vtable_->move(other.storage_, storage_);
+                other.vtable_ = nullptr;
+            }
+        }
+
+        return *this;
+    }
+
+    /// Destructor.
+    ~small_function() {
+        reset_();
+    }
+
+    /**
+     * \brief Check if this function contains a callable.
+     * \return 'true' if this function contains a callable
+     */
+    explicit operator bool() const noexcept {
+        return vtable_ != nullptr;
+    }
+
+    /**
+     * \brief Calls the stored callable.
+     * \param args The arguments to forward to the callable
+     * \return The value returned by the callable
+     * \note Throws std::bad_function_call if this function is empty.
+     */
+    R operator()(Args... args) const {
+        if (!vtable_)
+            throw std::bad_function_call();
+
+        return vtable_->invoke(storage_, std::forward<Args>(args)...);
+    }
+
+private:
+    void reset_() noexcept {
+        if (vtable_) {
+            vtable_->destroy(storage_);
+            vtable_ = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) mutable unsigned char storage_[BufferSize];
+    const vtable* vtable_ = nullptr;
+};
+
+} // namespace lxgui::utils
+
+#endif
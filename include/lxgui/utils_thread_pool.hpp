@@ -0,0 +1,85 @@
+#ifndef LXGUI_UTILS_THREAD_POOL_HPP
+#define LXGUI_UTILS_THREAD_POOL_HPP
+
+#include "lxgui/lxgui.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace lxgui::utils {
+
+/**
+ * \brief A pool of worker threads, running parallel loops.
+ * \details The iterations of a loop are split into small ranges, which are distributed
+ * among the threads. Each thread processes the ranges it was given first, then steals
+ * the remaining ranges of other threads. This keeps all threads busy, even when some
+ * iterations are more expensive than others. The calling thread participates in the loop.
+ * \note A loop can only be started from one thread at a time, and loops cannot be nested.
+ */
+class thread_pool {
+public:
+    /**
+     * \brief Constructor.
+     * \param thread_count The number of worker threads to create
+     * \note The calling thread is not counted in thread_count.
+     */
+    explicit thread_pool(std::size_t thread_count);
+
+    // Non-copiable, non-movable
+    thread_pool(const thread_pool&)            = delete;
+    thread_pool(thread_pool&&)                 = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+    thread_pool& operator=(thread_pool&&)      = delete;
+
+    /// Destructor; waits for all worker threads to stop.
+    ~thread_pool();
+
+    /**
+     * \brief Returns the number of worker threads.
+     * \return The number of worker threads
+     */
+    std::size_t get_thread_count() const;
+
+    /**
+     * \brief Calls a function for each index in [0, count), in parallel.
+     * \param count The number of iterations
+     * \param func The function to call, with the index of the iteration
+     * \note This function returns when all iterations are done. The function must be
+     * safe to call concurrently, and must not throw.
+     */
+    void parallel_for(std::size_t count, const std::function<void(std::size_t)>& func);
+
+private:
+    using range = std::pair<std::size_t, std::size_t>;
+
+    struct range_queue {
+        std::mutex        mutex;
+        std::deque<range> range_list;
+    };
+
+    void worker_loop_(std::size_t queue_id);
+    void run_ranges_(std::size_t queue_id, const std::function<void(std::size_t)>& func);
+    bool pop_range_(std::size_t queue_id, range& r);
+
+    std::vector<std::thread>                  thread_list_;
+    std::vector<std::unique_ptr<range_queue>> queue_list_;
+
+    std::mutex                              mutex_;
+    std::condition_variable                 start_condition_;
+    std::condition_variable                 done_condition_;
+    const std::function<void(std::size_t)>* func_       = nullptr;
+    std::size_t                             generation_ = 0u;
+    std::size_t                             busy_count_ = 0u;
+    bool                                    stop_       = false;
+};
+
+} // namespace lxgui::utils
+
+#endif
@@ -1,8 +1,13 @@
 #include "lxgui/gui_addon_registry.hpp"
 
 #include "lxgui/gui_event_emitter.hpp"
+#include "lxgui/gui_frame.hpp"
 #include "lxgui/gui_localizer.hpp"
+#include "lxgui/gui_manager.hpp"
 #include "lxgui/gui_out.hpp"
+#include "lxgui/gui_renderer.hpp"
+#include "lxgui/gui_root.hpp"
+#include "lxgui/gui_virtual_root.hpp"
 #include "lxgui/utils_file_system.hpp"
 #include "lxgui/utils_range.hpp"
 #include "lxgui/utils_std.hpp"
@@ -99,6 +104,11 @@ void addon_registry::load_addon_toc_(
 void addon_registry::load_addon_files_(const addon& a) {
     localizer_.load_translations(a.directory);
 
+    // Textures pre-packed by lxgui-atlas-bake, if any
+    const std::string atlas_manifest = a.directory + "/atlas.lxatlas";
+    if (utils::file_exists(atlas_manifest))
+        root_.get_manager().get_renderer().load_baked_atlas("GUI", atlas_manifest);
+
     current_addon_ = &a;
     for (const auto& file : a.file_list) {
         const std::string extension = utils::get_file_extension(file);
@@ -244,6 +254,89 @@ void addon_registry::save_variables_(const addon& a) const noexcept {
     }
 }
 
+namespace {
+
+void collect_addon_frames(
+    frame& obj, const addon& a, std::vector<utils::observer_ptr<frame>>& frame_list) {
+    if (obj.get_addon() == &a) {
+        // Children will be destroyed with their parent
+        frame_list.push_back(observer_from(&obj));
+        return;
+    }
+
+    for (auto& child : obj.get_children())
+        collect_addon_frames(child, a, frame_list);
+}
+
+} // namespace
+
+void addon_registry::destroy_addon_frames_(const addon& a) {
+    std::vector<utils::observer_ptr<frame>> frame_list;
+
+    for (auto& obj : root_.get_root_frames())
+        collect_addon_frames(obj, a, frame_list);
+
+    for (const auto& obj : frame_list) {
+        if (obj)
+            obj->destroy();
+    }
+
+    frame_list.clear();
+
+    for (auto& obj : virtual_root_.get_root_frames())
+        collect_addon_frames(obj, a, frame_list);
+
+    for (const auto& obj : frame_list) {
+        if (!obj)
+            continue;
+
+        // Virtual frames cannot be hidden or use destroy(), just release them
+        if (auto parent = obj->get_parent())
+            parent->remove_child(obj);
+        else
+            virtual_root_.remove_root_frame(obj);
+    }
+
+    root_.garbage_collect();
+    virtual_root_.garbage_collect();
+}
+
+bool addon_registry::reload_addon(const std::string& addon_name) {
+    for (auto& directory : addon_list_) {
+        auto iter = directory.second.find(addon_name);
+        if (iter == directory.second.end())
+            continue;
+
+        const bool enabled = iter->second.enabled;
+
+        save_variables_(iter->second);
+        destroy_addon_frames_(iter->second);
+
+        // Read the .toc file again, in case the file list changed
+        directory.second.erase(iter);
+        load_addon_toc_(addon_name, directory.first);
+
+        iter = directory.second.find(addon_name);
+        if (iter == directory.second.end()) {
+            gui::out << gui::error << "gui::addon_registry: could not re-load addon \""
+                     << addon_name << "\"." << std::endl;
+            return false;
+        }
+
+        iter->second.enabled = enabled && iter->second.enabled;
+        if (iter->second.enabled)
+            load_addon_files_(iter->second);
+
+        current_addon_ = nullptr;
+        return true;
+    }
+
+    gui::out << gui::warning << "gui::addon_registry: no addon named \"" << addon_name << "\"."
+             << std::endl;
+
+    return false;
+}
+
 const addon* addon_registry::get_current_addon() {
     return current_addon_;
 }
@@ -53,13 +53,22 @@ void anchor::update_parent_(region& object) {
 }
 
 vector2f anchor::get_point(const region& object) const {
+    if (parent_) {
+        // The target dimensions are not used
+        return get_point(object, vector2f::zero);
+    }
+
+    return get_point(object, object.get_effective_frame_renderer()->get_target_dimensions());
+}
+
+vector2f anchor::get_point(const region& object, const vector2f& target_dimensions) const {
     vector2f parent_pos;
     vector2f parent_size;
     if (const region* raw_parent = parent_.get()) {
         parent_pos  = raw_parent->get_borders().top_left();
         parent_size = raw_parent->get_apparent_dimensions();
     } else {
-        parent_size = object.get_effective_frame_renderer()->get_target_dimensions();
+        parent_size = target_dimensions;
     }
 
     vector2f offset_abs;
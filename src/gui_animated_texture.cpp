@@ -199,8 +199,8 @@ void animated_texture::update_tex_coords_() {
     quad_.v[3].uvs = vector2f(top_left.x, bottom_right.y);
 }
 
-void animated_texture::update_borders_() {
-    base::update_borders_();
+void animated_texture::notify_borders_updated_(const bounds2f& old_border_list, bool old_valid) {
+    base::notify_borders_updated_(old_border_list, old_valid);
 
     quad_.v[0].pos = borders_.top_left();
     quad_.v[1].pos = borders_.top_right();
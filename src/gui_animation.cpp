@@ -0,0 +1,396 @@
+#include "lxgui/gui_animation.hpp"
+
+#include "lxgui/gui_font_string.hpp"
+#include "lxgui/gui_frame.hpp"
+#include "lxgui/gui_out.hpp"
+#include "lxgui/gui_registry.hpp"
+#include "lxgui/gui_texture.hpp"
+#include "lxgui/utils_std.hpp"
+#include "lxgui/utils_string.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace lxgui::gui {
+
+namespace {
+
+float apply_smoothing(animation_smoothing smoothing, float progress) {
+    switch (smoothing) {
+    case animation_smoothing::none: return progress;
+    case animation_smoothing::in: return progress * progress;
+    case animation_smoothing::out: return 1.0f - (1.0f - progress) * (1.0f - progress);
+    case animation_smoothing::in_out:
+        if (progress < 0.5f)
+            return 2.0f * progress * progress;
+        else
+            return 1.0f - 2.0f * (1.0f - progress) * (1.0f - progress);
+    }
+
+    return progress;
+}
+
+template<typename T>
+T interpolate(const T& from, const T& to, float progress) {
+    return from + (to - from) * progress;
+}
+
+color interpolate(const color& from, const color& to, float progress) {
+    return color(
+        interpolate(from.r, to.r, progress), interpolate(from.g, to.g, progress),
+        interpolate(from.b, to.b, progress), interpolate(from.a, to.a, progress));
+}
+
+} // namespace
+
+animation_group::animation_group(frame& owner, std::string name) :
+    owner_(owner), name_(std::move(name)) {}
+
+void animation_group::copy_from(const animation_group& other) {
+    reset();
+
+    looping_          = other.looping_;
+    keep_final_state_ = other.keep_final_state_;
+    animation_list_   = other.animation_list_;
+
+    update_timeline_();
+}
+
+const std::string& animation_group::get_name() const {
+    return name_;
+}
+
+void animation_group::add_animation(animation anim) {
+    reset();
+
+    animation_list_.push_back(std::move(anim));
+
+    update_timeline_();
+}
+
+const std::vector<animation>& animation_group::get_animations() const {
+    return animation_list_;
+}
+
+void animation_group::set_looping(animation_looping looping) {
+    looping_ = looping;
+}
+
+animation_looping animation_group::get_looping() const {
+    return looping_;
+}
+
+float animation_group::get_duration() const {
+    return duration_;
+}
+
+void animation_group::set_keep_final_state(bool keep) {
+    keep_final_state_ = keep;
+}
+
+bool animation_group::get_keep_final_state() const {
+    return keep_final_state_;
+}
+
+void animation_group::update_timeline_() {
+    // Sort orders, and compute the start time of each
+    std::vector<std::size_t> order_list;
+    for (const auto& anim : animation_list_) {
+        if (utils::find(order_list, anim.order) == order_list.end())
+            order_list.push_back(anim.order);
+    }
+
+    std::sort(order_list.begin(), order_list.end());
+
+    start_time_list_.assign(animation_list_.size(), 0.0f);
+    duration_ = 0.0f;
+
+    for (const std::size_t order : order_list) {
+        float order_duration = 0.0f;
+        for (std::size_t i = 0u; i < animation_list_.size(); ++i) {
+            const auto& anim = animation_list_[i];
+            if (anim.order != order)
+                continue;
+
+            start_time_list_[i] = duration_ + anim.start_delay;
+            order_duration =
+                std::max(order_duration, anim.start_delay + anim.duration + anim.end_delay);
+        }
+
+        duration_ += order_duration;
+    }
+}
+
+std::size_t animation_group::resolve_target_(const std::string& name) {
+    utils::observer_ptr<region> target;
+    if (name.empty()) {
+        target = observer_from(&owner_);
+    } else {
+        std::string full_name = name;
+        utils::replace(full_name, "$parent", owner_.get_name());
+        target = owner_.get_registry().get_region_by_name(full_name);
+
+        if (!target) {
+            gui::out << gui::warning << "gui::animation_group: "
+                     << "Cannot find animation target \"" << full_name << "\" for \""
+                     << owner_.get_name() << "\"." << std::endl;
+        }
+    }
+
+    for (std::size_t i = 0u; i < target_list_.size(); ++i) {
+        if (target_list_[i].target == target)
+            return i;
+    }
+
+    target_list_.push_back(target_state{target});
+    return target_list_.size() - 1u;
+}
+
+void animation_group::play() {
+    reset();
+
+    if (animation_list_.empty() || owner_.is_virtual())
+        return;
+
+    target_index_list_.clear();
+    for (const auto& anim : animation_list_)
+        target_index_list_.push_back(resolve_target_(anim.target));
+
+    // Save the original properties, to restore them later
+    for (std::size_t i = 0u; i < animation_list_.size(); ++i) {
+        const auto& anim  = animation_list_[i];
+        auto&       state = target_list_[target_index_list_[i]];
+        if (!state.target)
+            continue;
+
+        if (anim.type == animation_type::alpha) {
+            state.has_alpha = true;
+        } else if (anim.type == animation_type::color && !state.has_color) {
+            if (const auto* tex = down_cast<texture>(state.target.get())) {
+                for (std::size_t j = 0u; j < 4u; ++j)
+                    state.original_colors[j] = tex->get_vertex_color(j);
+                state.has_color = true;
+            } else if (const auto* text = down_cast<font_string>(state.target.get())) {
+                state.original_colors[0] = text->get_text_color();
+                state.has_color          = true;
+            } else {
+                gui::out << gui::warning << "gui::animation_group: "
+                         << "Color animations can only target a Texture or a FontString (\""
+                         << state.target->get_name() << "\")." << std::endl;
+            }
+        } else if (anim.type == animation_type::tex_coords && !state.has_tex_coords) {
+            if (const auto* tex = down_cast<texture>(state.target.get())) {
+                state.original_tex_coords = tex->get_tex_coord();
+                state.has_tex_coords      = true;
+            } else {
+                gui::out << gui::warning << "gui::animation_group: "
+                         << "TexCoords animations can only target a Texture (\""
+                         << state.target->get_name() << "\")." << std::endl;
+            }
+        } else if (
+            anim.type == animation_type::translation || anim.type == animation_type::scale ||
+            anim.type == animation_type::rotation) {
+            if (down_cast<frame>(state.target.get())) {
+                state.has_transform = true;
+            } else {
+                gui::out << gui::warning << "gui::animation_group: "
+                         << "Translation, Scale and Rotation animations can only target a Frame "
+                         << "(\"" << state.target->get_name() << "\")." << std::endl;
+            }
+        }
+    }
+
+    is_playing_  = true;
+    is_reversed_ = false;
+    elapsed_     = 0.0f;
+
+    owner_.notify_animation_started_();
+
+    apply_(0.0f);
+}
+
+void animation_group::stop() {
+    if (!is_playing_)
+        return;
+
+    is_playing_ = false;
+
+    if (keep_final_state_)
+        apply_(is_reversed_ ? 0.0f : duration_);
+    else
+        reset_targets_();
+}
+
+void animation_group::reset() {
+    is_playing_ = false;
+    reset_targets_();
+}
+
+bool animation_group::is_playing() const {
+    return is_playing_;
+}
+
+bool animation_group::update(float delta) {
+    if (!is_playing_)
+        return false;
+
+    elapsed_ += delta;
+
+    if (elapsed_ >= duration_) {
+        switch (looping_) {
+        case animation_looping::none: stop(); return false;
+        case animation_looping::repeat:
+            elapsed_ = duration_ > 0.0f ? std::fmod(elapsed_, duration_) : 0.0f;
+            break;
+        case animation_looping::bounce:
+            elapsed_     = duration_ > 0.0f ? std::fmod(elapsed_, duration_) : 0.0f;
+            is_reversed_ = !is_reversed_;
+            break;
+        }
+    }
+
+    apply_(is_reversed_ ? duration_ - elapsed_ : elapsed_);
+    return true;
+}
+
+void animation_group::apply_(float time) {
+    for (auto& state : target_list_) {
+        state.alpha    = 1.0f;
+        state.offset   = vector2f::zero;
+        state.scale    = vector2f(1.0f, 1.0f);
+        state.rotation = 0.0f;
+
+        state.alpha_order      = std::numeric_limits<std::size_t>::max();
+        state.is_alpha_started = false;
+    }
+
+    // Select the alpha animations to apply on each target: those of the last order which
+    // has started, or of the first order if none has started yet
+    for (std::size_t i = 0u; i < animation_list_.size(); ++i) {
+        const auto& anim = animation_list_[i];
+        if (anim.type != animation_type::alpha)
+            continue;
+
+        auto&      state      = target_list_[target_index_list_[i]];
+        const bool is_started = time >= start_time_list_[i] - anim.start_delay;
+        if (is_started) {
+            if (!state.is_alpha_started || anim.order > state.alpha_order) {
+                state.alpha_order      = anim.order;
+                state.is_alpha_started = true;
+            }
+        } else if (!state.is_alpha_started) {
+            state.alpha_order = std::min(state.alpha_order, anim.order);
+        }
+    }
+
+    for (std::size_t i = 0u; i < animation_list_.size(); ++i) {
+        const auto& anim  = animation_list_[i];
+        auto&       state = target_list_[target_index_list_[i]];
+        if (!state.target)
+            continue;
+
+        // Animations which have not started yet have no effect, except alpha animations
+        // which apply their initial value (so a delayed fade in does not pop)
+        const float local_time = time - start_time_list_[i];
+        if (anim.type == animation_type::alpha) {
+            if (anim.order != state.alpha_order)
+                continue;
+        } else if (local_time < 0.0f) {
+            continue;
+        }
+
+        float progress = 0.0f;
+        if (local_time >= 0.0f)
+            progress = anim.duration > 0.0f ? std::min(local_time / anim.duration, 1.0f) : 1.0f;
+
+        progress = apply_smoothing(anim.smoothing, progress);
+
+        switch (anim.type) {
+        case animation_type::alpha:
+            state.alpha *= interpolate(anim.from_alpha, anim.to_alpha, progress);
+            break;
+        case animation_type::translation:
+            state.offset += anim.offset * progress;
+            break;
+        case animation_type::scale: {
+            const vector2f scale = interpolate(anim.from_scale, anim.to_scale, progress);
+            state.scale.x *= scale.x;
+            state.scale.y *= scale.y;
+            break;
+        }
+        case animation_type::rotation:
+            state.rotation += anim.degrees * progress;
+            break;
+        case animation_type::color:
+            if (!state.has_color)
+                break;
+
+            if (auto* tex = down_cast<texture>(state.target.get()))
+                tex->set_vertex_color(interpolate(anim.from_color, anim.to_color, progress));
+            else if (auto* text = down_cast<font_string>(state.target.get()))
+                text->set_text_color(interpolate(anim.from_color, anim.to_color, progress));
+            break;
+        case animation_type::tex_coords:
+            if (!state.has_tex_coords)
+                break;
+
+            if (auto* tex = down_cast<texture>(state.target.get())) {
+                std::array<float, 4> rect;
+                for (std::size_t j = 0u; j < 4u; ++j)
+                    rect[j] = interpolate(anim.from_tex_rect[j], anim.to_tex_rect[j], progress);
+
+                tex->set_tex_rect(rect);
+            }
+            break;
+        }
+    }
+
+    // Apply effects which are only used when rendering
+    for (auto& state : target_list_) {
+        if (!state.target)
+            continue;
+
+        if (state.has_alpha)
+            state.target->set_animation_alpha_(*this, state.alpha);
+
+        if (state.has_transform) {
+            if (auto* obj = down_cast<frame>(state.target.get()))
+                obj->set_animation_transform_(*this, state.offset, state.scale, state.rotation);
+        }
+    }
+}
+
+void animation_group::reset_targets_() {
+    for (auto& state : target_list_) {
+        if (!state.target)
+            continue;
+
+        if (state.has_alpha)
+            state.target->reset_animation_alpha_(*this);
+
+        if (state.has_transform) {
+            if (auto* obj = down_cast<frame>(state.target.get()))
+                obj->reset_animation_transform_(*this);
+        }
+
+        if (state.has_color) {
+            if (auto* tex = down_cast<texture>(state.target.get())) {
+                for (std::size_t j = 0u; j < 4u; ++j)
+                    tex->set_vertex_color(state.original_colors[j], j);
+            } else if (auto* text = down_cast<font_string>(state.target.get())) {
+                text->set_text_color(state.original_colors[0]);
+            }
+        }
+
+        if (state.has_tex_coords) {
+            if (auto* tex = down_cast<texture>(state.target.get()))
+                tex->set_tex_coord(state.original_tex_coords);
+        }
+    }
+
+    target_list_.clear();
+    target_index_list_.clear();
+}
+
+} // namespace lxgui::gui
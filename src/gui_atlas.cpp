@@ -5,8 +5,13 @@
 #include "lxgui/gui_out.hpp"
 #include "lxgui/gui_renderer.hpp"
 #include "lxgui/gui_vertex.hpp"
+#include "lxgui/utils_std.hpp"
 #include "lxgui/utils_string.hpp"
 
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
 namespace lxgui::gui {
 
 atlas_page::atlas_page(material::filter filt) : filter_(filt) {}
@@ -18,6 +23,10 @@ std::shared_ptr<material> atlas_page::fetch_material(const std::string& file_nam
             return lock;
     }
 
+    auto baked_iter = baked_material_list_.find(file_name);
+    if (baked_iter != baked_material_list_.end())
+        return create_material_(baked_iter->second);
+
     return nullptr;
 }
 
@@ -70,6 +79,9 @@ bool atlas_page::add_font(const std::string& font_name, std::shared_ptr<gui::fon
 }
 
 bool atlas_page::empty() const {
+    if (is_baked())
+        return false;
+
     for (const auto& mat : texture_list_) {
         if (std::shared_ptr<gui::material> lock = mat.second.lock())
             return false;
@@ -83,6 +95,75 @@ bool atlas_page::empty() const {
     return true;
 }
 
+std::size_t atlas_page::get_resource_count() const {
+    std::size_t count = 0u;
+
+    for (const auto& mat : texture_list_) {
+        if (!mat.second.expired())
+            ++count;
+    }
+
+    for (const auto& fnt : font_list_) {
+        if (!fnt.second.expired())
+            ++count;
+    }
+
+    return count;
+}
+
+void atlas_page::collect_resources(
+    std::vector<std::shared_ptr<material>>& material_list,
+    std::vector<std::shared_ptr<font>>&     font_list) const {
+    for (const auto& mat : texture_list_) {
+        if (std::shared_ptr<gui::material> lock = mat.second.lock())
+            material_list.push_back(std::move(lock));
+    }
+
+    for (const auto& fnt : font_list_) {
+        if (std::shared_ptr<gui::font> lock = fnt.second.lock())
+            font_list.push_back(std::move(lock));
+    }
+}
+
+void atlas_page::prune() {
+    for (auto iter = texture_list_.begin(); iter != texture_list_.end();) {
+        if (iter->second.expired())
+            iter = texture_list_.erase(iter);
+        else
+            ++iter;
+    }
+
+    for (auto iter = font_list_.begin(); iter != font_list_.end();) {
+        if (iter->second.expired())
+            iter = font_list_.erase(iter);
+        else
+            ++iter;
+    }
+}
+
+bool atlas_page::add_baked_page(
+    const material& page_mat, std::unordered_map<std::string, bounds2f> material_list) {
+    if (!empty())
+        return false;
+
+    try {
+        const auto rect = page_mat.get_rect();
+        if (rect.width() > get_width_() || rect.height() > get_height_())
+            return false;
+
+        add_material_(page_mat, bounds2f(0, rect.width(), 0, rect.height()));
+        baked_material_list_ = std::move(material_list);
+        return true;
+    } catch (const std::exception& e) {
+        gui::out << gui::warning << e.what() << std::endl;
+        return false;
+    }
+}
+
+bool atlas_page::is_baked() const {
+    return !baked_material_list_.empty();
+}
+
 std::optional<bounds2f> atlas_page::find_location_(float width, float height) const {
     constexpr float padding = 1.0f; // pixels
 
@@ -94,7 +175,7 @@ std::optional<bounds2f> atlas_page::find_location_(float width, float height) co
     const float atlast_height = get_height_();
 
     std::vector<bounds2f> occupied_space;
-    occupied_space.reserve(texture_list_.size());
+    occupied_space.reserve(texture_list_.size() + baked_material_list_.size());
 
     float max_width  = 0.0f;
     float max_height = 0.0f;
@@ -121,6 +202,13 @@ std::optional<bounds2f> atlas_page::find_location_(float width, float height) co
         }
     }
 
+    // Materials from a pre-packed page image always occupy their space, even when not in use
+    for (const auto& baked : baked_material_list_) {
+        occupied_space.push_back(apply_padding(baked.second));
+        max_width  = std::max(max_width, occupied_space.back().right);
+        max_height = std::max(max_height, occupied_space.back().bottom);
+    }
+
     float    best_area = std::numeric_limits<float>::infinity();
     bounds2f best_quad;
 
@@ -227,10 +315,118 @@ bool atlas::add_font(const std::string& font_name, std::shared_ptr<gui::font> fn
     }
 }
 
+bool atlas::load_baked_pages(const std::string& manifest_file) {
+    if (utils::find(baked_manifest_list_, manifest_file) != baked_manifest_list_.end())
+        return true;
+
+    std::ifstream file(manifest_file);
+    if (!file.is_open()) {
+        gui::out << gui::warning << "gui::atlas: Cannot open atlas manifest '" << manifest_file
+                 << "'." << std::endl;
+        return false;
+    }
+
+    std::string directory;
+    const auto  last_separator = manifest_file.find_last_of('/');
+    if (last_separator != std::string::npos)
+        directory = manifest_file.substr(0, last_separator + 1);
+
+    struct baked_page {
+        std::string                               file;
+        std::unordered_map<std::string, bounds2f> material_list;
+    };
+
+    std::vector<baked_page> baked_page_list;
+
+    // Each page is declared as "page <file>", followed by its materials, one per line,
+    // declared as "<left> <top> <width> <height> <file>". Lines starting with '#' are ignored.
+    std::string line;
+    std::size_t line_number = 0u;
+    while (std::getline(file, line)) {
+        ++line_number;
+        utils::replace(line, "\r", "");
+
+        std::string_view line_view = utils::trim(line, ' ');
+        if (line_view.empty() || line_view[0] == '#')
+            continue;
+
+        if (utils::starts_with(line_view, "page ")) {
+            baked_page_list.push_back(
+                {directory + std::string(utils::trim(line_view.substr(5), ' ')), {}});
+            continue;
+        }
+
+        std::istringstream stream{std::string(line_view)};
+        std::size_t        left = 0u, top = 0u, width = 0u, height = 0u;
+        std::string        name;
+        stream >> left >> top >> width >> height;
+        std::getline(stream >> std::ws, name);
+
+        if (stream.fail() || name.empty() || baked_page_list.empty()) {
+            gui::out << gui::warning << "gui::atlas: " << manifest_file << ":" << line_number
+                     << ": Invalid atlas manifest entry." << std::endl;
+            continue;
+        }
+
+        baked_page_list.back().material_list[directory + name] =
+            bounds2f(left, left + width, top, top + height);
+    }
+
+    bool loaded = false;
+    for (auto& baked : baked_page_list) {
+        // The top-left pixel of each page is white, see add_page_()
+        baked.material_list[""] = bounds2f(0, 1, 0, 1);
+
+        // NB: the page image is only needed until it is copied into the page
+        auto page_mat = renderer_.create_material(baked.file, filter_);
+        if (!page_mat)
+            continue;
+
+        page_item item;
+        item.page = create_page_();
+        if (!item.page->add_baked_page(*page_mat, std::move(baked.material_list))) {
+            gui::out << gui::warning << "gui::atlas: Could not fit atlas page '" << baked.file
+                     << "'; the atlas page size is too small." << std::endl;
+            continue;
+        }
+
+        item.no_texture_mat = item.page->fetch_material("");
+        page_list_.push_back(std::move(item));
+        loaded = true;
+    }
+
+    baked_manifest_list_.push_back(manifest_file);
+    return loaded;
+}
+
 std::size_t atlas::get_page_count() const {
     return page_list_.size();
 }
 
+void atlas::collect_resources(
+    std::vector<std::shared_ptr<material>>& material_list,
+    std::vector<std::shared_ptr<font>>&     font_list) const {
+    for (const auto& item : page_list_)
+        item.page->collect_resources(material_list, font_list);
+}
+
+void atlas::prune() {
+    for (const auto& item : page_list_)
+        item.page->prune();
+
+    // The white pixel material is owned by the page item, and does not count as a use.
+    auto iter_remove = std::remove_if(page_list_.begin(), page_list_.end(), [](const auto& item) {
+        // Pre-packed pages cannot be loaded again, keep them
+        if (item.page->is_baked())
+            return false;
+
+        const std::size_t owned_count = item.no_texture_mat ? 1u : 0u;
+        return item.page->get_resource_count() <= owned_count;
+    });
+
+    page_list_.erase(iter_remove, page_list_.end());
+}
+
 void atlas::add_page_() {
     page_item item;
     item.page = create_page_();
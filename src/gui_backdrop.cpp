@@ -8,45 +8,46 @@
 #include "lxgui/gui_renderer.hpp"
 #include "lxgui/utils_file_system.hpp"
 
+#include <cmath>
+
 namespace lxgui::gui {
 
-backdrop::backdrop(frame& parent) : parent_(parent) {}
+backdrop::backdrop(frame& parent) :
+    parent_(parent), definition_(std::make_shared<definition>()) {}
 
 void backdrop::copy_from(const backdrop& other) {
-    this->set_background(other.get_background_file());
-    this->set_edge(other.get_edge_file());
-
-    this->set_background_tilling(other.is_background_tilling());
-    this->set_tile_size(other.get_tile_size());
-
-    if (other.background_file_.empty())
-        this->set_background_color(other.get_background_color());
+    if (definition_ == other.definition_)
+        return;
 
-    this->set_background_insets(other.get_background_insets());
+    // Share the definition until one of the two backdrops is modified
+    definition_     = other.definition_;
+    is_cache_dirty_ = true;
+}
 
-    if (other.edge_file_.empty())
-        this->set_edge_color(other.get_edge_color());
+backdrop::definition& backdrop::get_mutable_definition_() {
+    if (definition_.use_count() > 1)
+        definition_ = std::make_shared<definition>(*definition_);
 
-    this->set_edge_size(other.get_edge_size());
-    this->set_edge_insets(other.get_edge_insets());
+    is_cache_dirty_ = true;
+    return *definition_;
 }
 
 void backdrop::set_background(const std::string& background_file) {
-    if (background_file_ == background_file)
+    if (definition_->background_file == background_file)
         return;
 
-    is_cache_dirty_   = true;
-    background_color_ = color::empty;
+    auto& def            = get_mutable_definition_();
+    def.background_color = color::empty;
 
     if (background_file.empty()) {
-        background_texture_ = nullptr;
-        background_file_    = "";
+        def.background_texture = nullptr;
+        def.background_file    = "";
         return;
     }
 
     if (!utils::file_exists(background_file)) {
-        background_texture_ = nullptr;
-        background_file_    = "";
+        def.background_texture = nullptr;
+        def.background_file    = "";
 
         gui::out << gui::warning << "backdrop: "
                  << "Cannot find file: \"" << background_file << "\" for " << parent_.get_name()
@@ -55,98 +56,95 @@ void backdrop::set_background(const std::string& background_file) {
         return;
     }
 
-    auto& renderer      = parent_.get_manager().get_renderer();
-    background_texture_ = renderer.create_atlas_material("GUI", background_file);
+    auto& renderer         = parent_.get_manager().get_renderer();
+    def.background_texture = renderer.create_atlas_material("GUI", background_file);
 
-    tile_size_ = original_tile_size_ = static_cast<float>(background_texture_->get_rect().width());
-    background_file_                 = background_file;
+    def.tile_size = def.original_tile_size =
+        static_cast<float>(def.background_texture->get_rect().width());
+    def.background_file = background_file;
 }
 
 const std::string& backdrop::get_background_file() const {
-    return background_file_;
+    return definition_->background_file;
 }
 
 void backdrop::set_background_color(const color& c) {
-    if (background_color_ == c)
+    if (definition_->background_color == c)
         return;
 
-    is_cache_dirty_ = true;
+    auto& def = get_mutable_definition_();
 
-    background_texture_ = nullptr;
-    background_color_   = c;
-    background_file_    = "";
+    def.background_texture = nullptr;
+    def.background_color   = c;
+    def.background_file    = "";
 
-    tile_size_ = original_tile_size_ = 256.0f;
+    def.tile_size = def.original_tile_size = 256.0f;
 }
 
 color backdrop::get_background_color() const {
-    return background_color_;
+    return definition_->background_color;
 }
 
 void backdrop::set_background_tilling(bool is_tilling) {
-    if (is_background_tilling_ == is_tilling)
+    if (definition_->is_background_tilling == is_tilling)
         return;
 
-    is_background_tilling_ = is_tilling;
-    is_cache_dirty_        = true;
+    get_mutable_definition_().is_background_tilling = is_tilling;
 }
 
 bool backdrop::is_background_tilling() const {
-    return is_background_tilling_;
+    return definition_->is_background_tilling;
 }
 
 void backdrop::set_tile_size(float tile_size) {
-    if (tile_size_ == tile_size)
+    if (definition_->tile_size == tile_size)
         return;
 
-    tile_size_      = tile_size;
-    is_cache_dirty_ = true;
+    get_mutable_definition_().tile_size = tile_size;
 }
 
 float backdrop::get_tile_size() const {
-    return tile_size_;
+    return definition_->tile_size;
 }
 
 void backdrop::set_background_insets(const bounds2f& insets) {
-    if (background_insets_ == insets)
+    if (definition_->background_insets == insets)
         return;
 
-    background_insets_ = insets;
-    is_cache_dirty_    = true;
+    get_mutable_definition_().background_insets = insets;
 }
 
 const bounds2f& backdrop::get_background_insets() const {
-    return background_insets_;
+    return definition_->background_insets;
 }
 
 void backdrop::set_edge_insets(const bounds2f& insets) {
-    if (edge_insets_ == insets)
+    if (definition_->edge_insets == insets)
         return;
 
-    edge_insets_    = insets;
-    is_cache_dirty_ = true;
+    get_mutable_definition_().edge_insets = insets;
 }
 
 const bounds2f& backdrop::get_edge_insets() const {
-    return edge_insets_;
+    return definition_->edge_insets;
 }
 
 void backdrop::set_edge(const std::string& edge_file) {
-    if (edge_file == edge_file_)
+    if (edge_file == definition_->edge_file)
         return;
 
-    is_cache_dirty_ = true;
-    edge_color_     = color::empty;
+    auto& def      = get_mutable_definition_();
+    def.edge_color = color::empty;
 
     if (edge_file.empty()) {
-        edge_texture_ = nullptr;
-        edge_file_    = "";
+        def.edge_texture = nullptr;
+        def.edge_file    = "";
         return;
     }
 
     if (!utils::file_exists(edge_file)) {
-        edge_texture_ = nullptr;
-        edge_file_    = "";
+        def.edge_texture = nullptr;
+        def.edge_file    = "";
 
         gui::out << gui::warning << "backdrop: "
                  << "Cannot find file: \"" << edge_file << "\" for " << parent_.get_name()
@@ -155,12 +153,12 @@ void backdrop::set_edge(const std::string& edge_file) {
         return;
     }
 
-    auto& renderer = parent_.get_manager().get_renderer();
-    edge_texture_  = renderer.create_atlas_material("GUI", edge_file);
+    auto& renderer   = parent_.get_manager().get_renderer();
+    def.edge_texture = renderer.create_atlas_material("GUI", edge_file);
 
-    if (edge_texture_->get_rect().width() / edge_texture_->get_rect().height() != 8.0f) {
-        edge_texture_ = nullptr;
-        edge_file_    = "";
+    if (def.edge_texture->get_rect().width() / def.edge_texture->get_rect().height() != 8.0f) {
+        def.edge_texture = nullptr;
+        def.edge_file    = "";
 
         gui::out << gui::error << "backdrop: "
                  << "An edge texture width must be exactly 8 times greater than its height "
@@ -170,43 +168,42 @@ void backdrop::set_edge(const std::string& edge_file) {
         return;
     }
 
-    edge_size_ = original_edge_size_ = edge_texture_->get_rect().height();
-    edge_file_                       = edge_file;
+    def.edge_size = def.original_edge_size = def.edge_texture->get_rect().height();
+    def.edge_file                          = edge_file;
 }
 
 const std::string& backdrop::get_edge_file() const {
-    return edge_file_;
+    return definition_->edge_file;
 }
 
 void backdrop::set_edge_color(const color& c) {
-    if (edge_color_ == c)
+    if (definition_->edge_color == c)
         return;
 
-    is_cache_dirty_ = true;
-    edge_texture_   = nullptr;
-    edge_color_     = c;
-    edge_file_      = "";
+    auto& def        = get_mutable_definition_();
+    def.edge_texture = nullptr;
+    def.edge_color   = c;
+    def.edge_file    = "";
 
-    if (edge_size_ == 0.0f)
-        edge_size_ = 1.0f;
+    if (def.edge_size == 0.0f)
+        def.edge_size = 1.0f;
 
-    original_edge_size_ = 1.0f;
+    def.original_edge_size = 1.0f;
 }
 
 color backdrop::get_edge_color() const {
-    return edge_color_;
+    return definition_->edge_color;
 }
 
 void backdrop::set_edge_size(float edge_size) {
-    if (edge_size_ == edge_size)
+    if (definition_->edge_size == edge_size)
         return;
 
-    edge_size_      = edge_size;
-    is_cache_dirty_ = true;
+    get_mutable_definition_().edge_size = edge_size;
 }
 
 float backdrop::get_edge_size() const {
-    return edge_size_;
+    return definition_->edge_size;
 }
 
 void backdrop::set_vertex_color(const color& c) {
@@ -218,6 +215,8 @@ void backdrop::set_vertex_color(const color& c) {
 }
 
 void backdrop::render() const {
+    const auto& def = *definition_;
+
     float alpha = parent_.get_effective_alpha();
     if (alpha != cache_alpha_)
         is_cache_dirty_ = true;
@@ -226,8 +225,8 @@ void backdrop::render() const {
     bool  use_vertex_cache =
         renderer.is_vertex_cache_enabled() && !renderer.is_quad_batching_enabled();
 
-    bool has_background = background_texture_ || background_color_ != color::empty;
-    bool has_edge       = edge_texture_ || edge_color_ != color::empty;
+    bool has_background = def.background_texture || def.background_color != color::empty;
+    bool has_edge       = def.edge_texture || def.edge_color != color::empty;
 
     if (has_background) {
         if ((use_vertex_cache && !background_cache_) ||
@@ -244,16 +243,21 @@ void backdrop::render() const {
 
     if (has_background) {
         if (use_vertex_cache && background_cache_)
-            renderer.render_cache(background_texture_.get(), *background_cache_);
+            renderer.render_cache(def.background_texture.get(), *background_cache_);
+        else if (!background_tile_rects_.empty())
+            renderer.render_tiled_quads(
+                def.background_texture.get(), background_quads_, background_tile_rects_);
         else
-            renderer.render_quads(background_texture_.get(), background_quads_);
+            renderer.render_quads(def.background_texture.get(), background_quads_);
     }
 
     if (has_edge) {
         if (use_vertex_cache && edge_cache_)
-            renderer.render_cache(edge_texture_.get(), *edge_cache_);
+            renderer.render_cache(def.edge_texture.get(), *edge_cache_);
+        else if (!edge_tile_rects_.empty())
+            renderer.render_tiled_quads(def.edge_texture.get(), edge_quads_, edge_tile_rects_);
         else
-            renderer.render_quads(edge_texture_.get(), edge_quads_);
+            renderer.render_quads(def.edge_texture.get(), edge_quads_);
     }
 }
 
@@ -266,7 +270,9 @@ void backdrop::update_cache_() const {
         return;
 
     background_quads_.clear();
+    background_tile_rects_.clear();
     edge_quads_.clear();
+    edge_tile_rects_.clear();
 
     color color = vertex_color_;
 
@@ -340,33 +346,115 @@ void repeat_wrap(
     }
 }
 
+bool use_tiled_quads(const renderer& renderer) {
+    // Tiled quads cannot be stored in vertex caches; in that case, tile on the CPU once
+    // and keep the result in the cache
+    return renderer.is_quad_tiling_supported() &&
+           !(renderer.is_vertex_cache_enabled() && !renderer.is_quad_batching_enabled());
+}
+
+void tile_wrap(
+    const frame&                        parent,
+    std::vector<std::array<vertex, 4>>& output,
+    std::vector<bounds2f>&              tile_rect_output,
+    const bounds2f&                     source_uvs,
+    float                               tile_size,
+    bool                                is_rotated,
+    const color                         color,
+    const bounds2f&                     destination) {
+    const float dest_width  = destination.width();
+    const float dest_height = destination.height();
+    if (dest_width <= 0.0f || dest_height <= 0.0f)
+        return;
+
+    // Texture coordinates are in number of tiles, and the renderer repeats the texture
+    // inside the source region (see renderer::render_tiled_quads())
+    const auto add_quad = [&](const bounds2f& rect, const std::array<vector2f, 4>& uvs) {
+        output.emplace_back();
+        auto& quad = output.back();
+
+        quad[0].pos = parent.round_to_pixel(rect.top_left());
+        quad[1].pos = parent.round_to_pixel(rect.top_right());
+        quad[2].pos = parent.round_to_pixel(rect.bottom_right());
+        quad[3].pos = parent.round_to_pixel(rect.bottom_left());
+
+        for (std::size_t i = 0; i < 4; ++i) {
+            quad[i].uvs = uvs[i];
+            quad[i].col = color;
+        }
+
+        tile_rect_output.push_back(source_uvs);
+    };
+
+    const float num_tiles_x = dest_width / tile_size;
+    const float num_tiles_y = dest_height / tile_size;
+
+    if (!is_rotated) {
+        add_quad(
+            destination, {vector2f(0.0f, 0.0f), vector2f(num_tiles_x, 0.0f),
+                          vector2f(num_tiles_x, num_tiles_y), vector2f(0.0f, num_tiles_y)});
+        return;
+    }
+
+    // Rotated tiles run backwards along the edge, and the last tile is cut at its start
+    // rather than at its end (as in repeat_wrap()), which a single ramp of texture
+    // coordinates cannot represent. Render the last partial tile as a separate quad.
+    const float num_full_tiles = std::floor(num_tiles_x);
+    const float split          = destination.left + num_full_tiles * tile_size;
+
+    if (num_full_tiles > 0.0f) {
+        add_quad(
+            bounds2f(destination.left, split, destination.top, destination.bottom),
+            {vector2f(0.0f, 1.0f), vector2f(0.0f, 1.0f - num_full_tiles),
+             vector2f(num_tiles_y, 1.0f - num_full_tiles), vector2f(num_tiles_y, 1.0f)});
+    }
+
+    if (split < destination.right) {
+        const float last_tile = num_tiles_x - num_full_tiles;
+        add_quad(
+            bounds2f(split, destination.right, destination.top, destination.bottom),
+            {vector2f(0.0f, last_tile), vector2f(0.0f, 0.0f), vector2f(num_tiles_y, 0.0f),
+             vector2f(num_tiles_y, last_tile)});
+    }
+}
+
 void backdrop::update_background_(color c) const {
-    if (!background_texture_ && background_color_ == color::empty)
+    const auto& def = *definition_;
+
+    if (!def.background_texture && def.background_color == color::empty)
         return;
 
-    if (!background_texture_)
-        c *= background_color_;
+    if (!def.background_texture)
+        c *= def.background_color;
 
     auto borders = parent_.get_borders();
-    borders.left += background_insets_.left;
-    borders.right -= background_insets_.right;
-    borders.top += background_insets_.top;
-    borders.bottom -= background_insets_.bottom;
+    borders.left += def.background_insets.left;
+    borders.right -= def.background_insets.right;
+    borders.top += def.background_insets.top;
+    borders.bottom -= def.background_insets.bottom;
 
     auto& renderer = parent_.get_manager().get_renderer();
 
-    if (background_texture_) {
-        const vector2f canvas_tl  = background_texture_->get_canvas_uv(vector2f(0.0f, 0.0f), true);
-        const vector2f canvas_br  = background_texture_->get_canvas_uv(vector2f(1.0f, 1.0f), true);
+    if (def.background_texture) {
+        const auto&    texture    = *def.background_texture;
+        const vector2f canvas_tl  = texture.get_canvas_uv(vector2f(0.0f, 0.0f), true);
+        const vector2f canvas_br  = texture.get_canvas_uv(vector2f(1.0f, 1.0f), true);
         const bounds2f canvas_uvs = bounds2f(canvas_tl.x, canvas_br.x, canvas_tl.y, canvas_br.y);
 
         float rounded_tile_size =
-            parent_.round_to_pixel(tile_size_, utils::rounding_method::nearest_not_zero);
+            parent_.round_to_pixel(def.tile_size, utils::rounding_method::nearest_not_zero);
 
-        if (background_texture_->is_in_atlas() && is_background_tilling_ &&
+        if (def.background_texture->is_in_atlas() && def.is_background_tilling &&
             rounded_tile_size > 1.0f) {
-            repeat_wrap(
-                parent_, background_quads_, canvas_uvs, rounded_tile_size, false, c, borders);
+            if (use_tiled_quads(renderer)) {
+                tile_wrap(
+                    parent_, background_quads_, background_tile_rects_, canvas_uvs,
+                    rounded_tile_size, false, c, borders);
+            } else {
+                repeat_wrap(
+                    parent_, background_quads_, canvas_uvs, rounded_tile_size, false, c,
+                    borders);
+            }
         } else {
             background_quads_.emplace_back();
             auto& quad = background_quads_.back();
@@ -407,36 +495,44 @@ void backdrop::update_background_(color c) const {
 }
 
 void backdrop::update_edge_(color c) const {
-    if (!edge_texture_ && edge_color_ == color::empty)
+    const auto& def = *definition_;
+
+    if (!def.edge_texture && def.edge_color == color::empty)
         return;
 
-    if (!edge_texture_)
-        c *= edge_color_;
+    if (!def.edge_texture)
+        c *= def.edge_color;
 
     constexpr float uv_step = 1.0f / 8.0f;
     auto            borders = parent_.get_borders();
-    borders.left += edge_insets_.left;
-    borders.right -= edge_insets_.right;
-    borders.top += edge_insets_.top;
-    borders.bottom -= edge_insets_.bottom;
+    borders.left += def.edge_insets.left;
+    borders.right -= def.edge_insets.right;
+    borders.top += def.edge_insets.top;
+    borders.bottom -= def.edge_insets.bottom;
 
     auto&       renderer = parent_.get_manager().get_renderer();
     const float rounded_edge_size =
-        parent_.round_to_pixel(edge_size_, utils::rounding_method::nearest_not_zero);
+        parent_.round_to_pixel(def.edge_size, utils::rounding_method::nearest_not_zero);
 
     auto repeat_wrap_edge = [&](const bounds2f& source_uvs, bool is_rotated,
                                 const bounds2f& destination) {
-        if (edge_texture_) {
-            const vector2f canvas_tl = edge_texture_->get_canvas_uv(source_uvs.top_left(), true);
+        if (def.edge_texture) {
+            const vector2f canvas_tl = def.edge_texture->get_canvas_uv(source_uvs.top_left(), true);
             const vector2f canvas_br =
-                edge_texture_->get_canvas_uv(source_uvs.bottom_right(), true);
+                def.edge_texture->get_canvas_uv(source_uvs.bottom_right(), true);
             const bounds2f canvas_uvs =
                 bounds2f(canvas_tl.x, canvas_br.x, canvas_tl.y, canvas_br.y);
 
-            if (edge_texture_->is_in_atlas() && rounded_edge_size > 1.0f) {
-                repeat_wrap(
-                    parent_, edge_quads_, canvas_uvs, rounded_edge_size, is_rotated, c,
-                    destination);
+            if (def.edge_texture->is_in_atlas() && rounded_edge_size > 1.0f) {
+                if (use_tiled_quads(renderer)) {
+                    tile_wrap(
+                        parent_, edge_quads_, edge_tile_rects_, canvas_uvs, rounded_edge_size,
+                        is_rotated, c, destination);
+                } else {
+                    repeat_wrap(
+                        parent_, edge_quads_, canvas_uvs, rounded_edge_size, is_rotated, c,
+                        destination);
+                }
             } else {
                 edge_quads_.emplace_back();
                 auto& quad = edge_quads_.back();
@@ -7,6 +7,7 @@
 #include "lxgui/gui_region_tpl.hpp"
 #include "lxgui/gui_renderer.hpp"
 
+#include <algorithm>
 #include <sstream>
 
 namespace lxgui::gui {
@@ -64,6 +65,32 @@ void font_string::render() const {
     text_->render(matrix4f::translation(round_to_pixel(pos)));
 }
 
+bounds2f font_string::get_render_bounds() const {
+    if (!text_)
+        return borders_;
+
+    // Allow the text to extend past any border, by its full size
+    const float width  = text_->get_width();
+    const float height = text_->get_height();
+
+    bounds2f bounds(
+        borders_.left - width, borders_.right + width, borders_.top - height,
+        borders_.bottom + height);
+
+    bounds = bounds + offset_;
+
+    if (is_shadow_enabled_) {
+        const bounds2f shadow_bounds = bounds + shadow_offset_;
+
+        bounds.left   = std::min(bounds.left, shadow_bounds.left);
+        bounds.right  = std::max(bounds.right, shadow_bounds.right);
+        bounds.top    = std::min(bounds.top, shadow_bounds.top);
+        bounds.bottom = std::max(bounds.bottom, shadow_bounds.bottom);
+    }
+
+    return bounds;
+}
+
 std::string font_string::serialize(const std::string& tab) const {
     std::ostringstream str;
 
@@ -479,7 +506,8 @@ void font_string::update_borders_() {
         float x_center = 0.0f, y_center = 0.0f;
 
         DEBUG_LOG("  Read anchors");
-        read_anchors_(left, right, top, bottom, x_center, y_center);
+        const vector2f target_dimensions = get_effective_frame_renderer()->get_target_dimensions();
+        read_anchors_(left, right, top, bottom, x_center, y_center, target_dimensions);
 
         float box_width = std::numeric_limits<float>::infinity();
         if (get_dimensions().x != 0.0f)
@@ -547,13 +575,16 @@ void font_string::update_borders_() {
     borders_.top    = round_to_pixel(borders_.top);
     borders_.bottom = round_to_pixel(borders_.bottom);
 
-    if (borders_ != old_border_list || is_valid_ != old_valid) {
-        DEBUG_LOG("  Fire redraw");
-        notify_renderer_need_redraw();
-    }
+    DEBUG_LOG("  Fire redraw");
+    notify_borders_updated_(old_border_list, old_valid);
     DEBUG_LOG("  @");
 }
 
+bool font_string::can_compute_borders_in_parallel_() const {
+    // The text layout is not thread-safe
+    return text_ == nullptr;
+}
+
 const std::vector<std::string>& font_string::get_type_list_() const {
     return get_type_list_impl_<font_string>();
 }
@@ -10,10 +10,15 @@
 #include "lxgui/gui_manager.hpp"
 #include "lxgui/gui_out.hpp"
 #include "lxgui/gui_region_tpl.hpp"
+#include "lxgui/gui_render_target.hpp"
+#include "lxgui/gui_renderer.hpp"
+#include "lxgui/gui_root.hpp"
 #include "lxgui/utils_range.hpp"
 #include "lxgui/utils_std.hpp"
 #include "lxgui/utils_string.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <lxgui/extern_sol2_as_args.hpp>
 #include <lxgui/extern_sol2_state.hpp>
@@ -23,17 +28,30 @@
 namespace lxgui::gui {
 
 frame::frame(utils::control_block& block, manager& mgr, const frame_core_attributes& attr) :
-    base(block, mgr, attr), event_receiver_(mgr.get_event_emitter()), frame_renderer_(attr.rdr) {
+    base(block, mgr, attr),
+    child_list_(child_list::allocator_type(mgr.get_memory_arena())),
+    region_list_(region_list::allocator_type(mgr.get_memory_arena())),
+    signal_list_(signal_map::allocator_type(mgr.get_memory_arena())),
+    event_receiver_(mgr.get_event_emitter()),
+    frame_renderer_(attr.rdr) {
+
+    const auto allocator = region_list_.get_allocator();
+    for (auto& layer : layer_list_)
+        layer.region_list = decltype(layer.region_list)(allocator);
 
     initialize_(*this, attr);
 
     if (parent_) {
-        level_ = parent_->get_level() + 1;
+        level_                    = parent_->get_level() + 1;
+        effective_scale_          = parent_->get_effective_scale() * scale_;
+        is_animation_transformed_ = parent_->is_animation_transformed();
     }
 
     effective_frame_renderer_ = compute_top_level_frame_renderer_();
     effective_strata_         = compute_effective_strata_();
 
+    update_render_cache_owner_();
+
     if (!is_virtual_) {
         // Tell the renderer to render this region
         get_effective_frame_renderer()->notify_rendered_frame(observer_from(this), true);
@@ -44,6 +62,10 @@ frame::~frame() {
     // Disable callbacks
     signal_list_.clear();
 
+    // Reset the properties of animated regions
+    for (auto& group : animation_group_list_)
+        group->reset();
+
     // Children must be destroyed first
     child_list_.clear();
     region_list_.clear();
@@ -62,25 +84,130 @@ frame::~frame() {
 void frame::render() const {
     base::render();
 
+    // Frames in a cached bitmap are rendered by the frame owning the bitmap
+    if (!is_in_render_cache())
+        render_cached_or_direct_(nullptr);
+}
+
+void frame::render(const bounds2f& clip_bounds) const {
+    base::render();
+
+    if (!is_in_render_cache())
+        render_cached_or_direct_(&clip_bounds);
+}
+
+void frame::render_cached_or_direct_(const bounds2f* clip_bounds) const {
+    if (is_render_cached_ && !is_rendering_cache_ && render_cache_target_)
+        blit_render_cache_(clip_bounds);
+    else
+        render_(clip_bounds);
+}
+
+void frame::blit_render_cache_(const bounds2f* clip_bounds) const {
+    if (!is_visible() || !is_valid_)
+        return;
+
+    renderer& rdr = manager_.get_renderer();
+
+    if (!is_animation_transformed_ && clip_bounds && !borders_.overlaps(*clip_bounds)) {
+        rdr.notify_frame_culled();
+        return;
+    }
+
+    matrix4f old_view;
+    if (is_animation_transformed_) {
+        old_view = rdr.get_view();
+        rdr.set_view(get_render_transform_() * old_view);
+    }
+
+    rdr.render_quad(render_cache_quad_);
+
+    if (is_animation_transformed_)
+        rdr.set_view(old_view);
+}
+
+void frame::render_(const bounds2f* clip_bounds) const {
     if (!is_visible() || !is_valid_)
         return;
 
+    renderer& rdr = manager_.get_renderer();
+
+    // Animated frames may be moved into view, do not skip them
+    if (is_animation_transformed_)
+        clip_bounds = nullptr;
+
+    if (clip_bounds && !get_render_bounds().overlaps(*clip_bounds)) {
+        rdr.notify_frame_culled();
+        return;
+    }
+
+    matrix4f old_view;
+    if (is_animation_transformed_) {
+        old_view = rdr.get_view();
+        rdr.set_view(get_render_transform_() * old_view);
+    }
+
     if (backdrop_) {
         backdrop_->render();
     }
 
     // Render child regions
-    for (const auto& layer : layer_list_) {
+    render_layered_regions_(clip_bounds);
+
+    if (is_animation_transformed_)
+        rdr.set_view(old_view);
+}
+
+void frame::render_layered_regions_(const bounds2f* clip_bounds) const {
+    render_layers_(layer::background, layer::special_high, clip_bounds);
+}
+
+void frame::render_layers_(layer first, layer last, const bounds2f* clip_bounds) const {
+    renderer& rdr = manager_.get_renderer();
+
+    const std::size_t first_index = static_cast<std::size_t>(first);
+    const std::size_t last_index  = static_cast<std::size_t>(last);
+
+    for (std::size_t i = first_index; i <= last_index; ++i) {
+        const auto& layer = layer_list_[i];
         if (layer.is_disabled) {
             continue;
         }
 
         for (const auto& reg : layer.region_list) {
+            if (clip_bounds && !reg->get_render_bounds().overlaps(*clip_bounds)) {
+                rdr.notify_region_culled();
+                continue;
+            }
+
             reg->render();
         }
     }
 }
 
+bounds2f frame::get_render_bounds() const {
+    if (!is_render_bounds_dirty_)
+        return render_bounds_;
+
+    render_bounds_ = borders_;
+    for (const auto& layer : layer_list_) {
+        for (const auto& reg : layer.region_list) {
+            if (!reg->is_valid())
+                continue;
+
+            const bounds2f bounds = reg->get_render_bounds();
+
+            render_bounds_.left   = std::min(render_bounds_.left, bounds.left);
+            render_bounds_.right  = std::max(render_bounds_.right, bounds.right);
+            render_bounds_.top    = std::min(render_bounds_.top, bounds.top);
+            render_bounds_.bottom = std::max(render_bounds_.bottom, bounds.bottom);
+        }
+    }
+
+    is_render_bounds_dirty_ = false;
+    return render_bounds_;
+}
+
 std::string frame::serialize(const std::string& tab) const {
     std::ostringstream str;
 
@@ -181,7 +308,8 @@ std::string frame::serialize(const std::string& tab) const {
 }
 
 bool frame::can_use_script(const std::string& script_name) const {
-    return script_name == "OnChar" || script_name == "OnDragStart" || script_name == "OnDragStop" ||
+    return script_name == "OnAnimationFinished" || script_name == "OnChar" ||
+           script_name == "OnDragStart" || script_name == "OnDragStop" ||
            script_name == "OnDragMove" || script_name == "OnEnter" || script_name == "OnEvent" ||
            script_name == "OnFocusGained" || script_name == "OnFocusLost" ||
            script_name == "OnHide" || script_name == "OnKeyDown" || script_name == "OnKeyUp" ||
@@ -216,6 +344,7 @@ void frame::copy_from(const region& obj) {
 
     this->set_movable(frame_obj->is_movable());
     this->set_clamped_to_screen(frame_obj->is_clamped_to_screen());
+    this->set_render_cached(frame_obj->is_render_cached());
     this->set_resizable(frame_obj->is_resizable());
 
     this->set_abs_hit_rect_insets(frame_obj->get_abs_hit_rect_insets());
@@ -228,6 +357,9 @@ void frame::copy_from(const region& obj) {
 
     this->set_update_rate(frame_obj->get_update_rate());
 
+    for (const auto& group : frame_obj->animation_group_list_)
+        this->add_animation_group(group->get_name()).copy_from(*group);
+
     for (const auto& art : frame_obj->region_list_) {
         if (!art || art->is_manually_inherited())
             continue;
@@ -528,6 +660,10 @@ void frame::set_parent_(utils::observer_ptr<frame> parent) {
 
     base::set_parent_(parent);
 
+    update_effective_scale_();
+    update_animation_transformed_();
+    update_render_cache_owner_();
+
     if (!is_virtual()) {
         // Notify visibility
         if (raw_new_parent) {
@@ -718,10 +854,303 @@ frame::const_child_list_view frame::get_children() const {
 }
 
 float frame::get_effective_scale() const {
+    return effective_scale_;
+}
+
+void frame::update_effective_scale_() {
+    const float effective_scale = parent_ ? parent_->effective_scale_ * scale_ : scale_;
+    if (effective_scale_ == effective_scale)
+        return;
+
+    effective_scale_ = effective_scale;
+    notify_renderer_need_redraw();
+
+    for (auto& child : get_children())
+        child.update_effective_scale_();
+}
+
+void frame::notify_effective_alpha_changed_() {
+    base::notify_effective_alpha_changed_();
+
+    if (title_region_)
+        title_region_->update_effective_alpha_();
+
+    for (auto& obj : get_regions())
+        obj.update_effective_alpha_();
+
+    for (auto& child : get_children())
+        child.update_effective_alpha_();
+}
+
+void frame::set_animation_transform_(
+    const animation_group& group,
+    const vector2f&        offset,
+    const vector2f&        scale,
+    float                  rotation) {
+    auto iter = utils::find_if(
+        animation_transform_list_, [&](const auto& t) { return t.group == &group; });
+
+    if (iter == animation_transform_list_.end())
+        iter = animation_transform_list_.insert(iter, animation_transform{&group});
+
+    iter->offset   = offset;
+    iter->scale    = scale;
+    iter->rotation = rotation;
+
+    update_animation_transform_();
+}
+
+void frame::reset_animation_transform_(const animation_group& group) {
+    auto iter = utils::find_if(
+        animation_transform_list_, [&](const auto& t) { return t.group == &group; });
+
+    if (iter == animation_transform_list_.end())
+        return;
+
+    animation_transform_list_.erase(iter);
+    update_animation_transform_();
+}
+
+void frame::update_animation_transform_() {
+    // Combine the transforms of all animation groups, as within a group
+    vector2f offset   = vector2f::zero;
+    vector2f scale    = vector2f(1.0f, 1.0f);
+    float    rotation = 0.0f;
+    for (const auto& transform : animation_transform_list_) {
+        offset += transform.offset;
+        scale.x *= transform.scale.x;
+        scale.y *= transform.scale.y;
+        rotation += transform.rotation;
+    }
+
+    if (animation_offset_ == offset && animation_scale_ == scale &&
+        animation_rotation_ == rotation)
+        return;
+
+    animation_offset_        = offset;
+    animation_scale_         = scale;
+    animation_rotation_      = rotation;
+    has_animation_transform_ = offset != vector2f::zero || scale != vector2f(1.0f, 1.0f) ||
+                               rotation != 0.0f;
+
+    update_animation_transformed_();
+
+    // The transform applies to all children, which are rendered separately
+    std::vector<frame*> frame_stack = {this};
+    while (!frame_stack.empty()) {
+        frame* obj = frame_stack.back();
+        frame_stack.pop_back();
+
+        obj->notify_renderer_need_redraw();
+        for (auto& child : obj->get_children())
+            frame_stack.push_back(&child);
+    }
+}
+
+void frame::update_animation_transformed_() {
+    const bool is_transformed =
+        has_animation_transform_ || (parent_ && parent_->is_animation_transformed_);
+    if (is_animation_transformed_ == is_transformed)
+        return;
+
+    is_animation_transformed_ = is_transformed;
+
+    for (auto& child : get_children())
+        child.update_animation_transformed_();
+}
+
+bool frame::is_animation_transformed() const {
+    return is_animation_transformed_;
+}
+
+matrix4f frame::get_animation_transform() const {
+    return compute_animation_transform_(nullptr);
+}
+
+matrix4f frame::get_render_transform_() const {
+    // Frames rendered in a cached bitmap only use the transforms up to the frame owning
+    // the bitmap; its own transform applies to the bitmap.
+    return compute_animation_transform_(get_active_render_cache_());
+}
+
+matrix4f frame::compute_animation_transform_(const frame* stop_frame) const {
+    constexpr float deg_to_rad = 3.14159265358979f / 180.0f;
+
+    // Frames rendered in a render target (e.g., scroll children) only use the transforms
+    // up to the frame owning the render target; its own transform applies to the target.
+    const auto* renderer_frame = dynamic_cast<const frame*>(get_effective_frame_renderer().get());
+
+    matrix4f transform;
+
+    // Apply this frame's transform first, then that of its parents
+    for (const frame* obj = this; obj && obj != renderer_frame && obj != stop_frame;
+         obj = obj->parent_.get()) {
+        if (!obj->has_animation_transform_)
+            continue;
+
+        // Scale and rotate around the center; rotation is counter-clockwise on screen
+        const vector2f center = obj->get_center();
+        transform = transform * matrix4f::translation(-center) *
+                    matrix4f::scaling(obj->animation_scale_) *
+                    matrix4f::rotation(-obj->animation_rotation_ * deg_to_rad) *
+                    matrix4f::translation(center + obj->animation_offset_);
+    }
+
+    return transform;
+}
+
+void frame::set_render_cached(bool cached) {
+    if (is_render_cached_ == cached)
+        return;
+
+    is_render_cached_      = cached;
+    is_render_cache_dirty_ = true;
+
+    if (is_render_cached_) {
+        get_manager().get_root().register_render_cached_frame(*this);
+    } else {
+        render_cache_target_   = nullptr;
+        render_cache_quad_.mat = nullptr;
+    }
+
+    for (auto& child : get_children())
+        child.update_render_cache_owner_();
+
+    notify_renderer_need_redraw();
+}
+
+bool frame::is_render_cached() const {
+    return is_render_cached_;
+}
+
+bool frame::is_in_render_cache() const {
+    // Frames rendered by another frame renderer (e.g., a scroll_frame in the cached
+    // frame) are rendered by that frame renderer, which is itself in the cached bitmap
+    return render_cache_owner_ && render_cache_owner_->get_effective_frame_renderer() ==
+                                      get_effective_frame_renderer();
+}
+
+void frame::update_render_cache_owner_() {
+    utils::observer_ptr<frame> owner = nullptr;
     if (parent_)
-        return scale_ * parent_->get_effective_scale();
-    else
-        return scale_;
+        owner = parent_->is_render_cached_ ? parent_ : parent_->render_cache_owner_;
+
+    if (render_cache_owner_ == owner)
+        return;
+
+    // Both the previous and the new cached bitmaps need to be rendered again
+    for (frame* obj : {render_cache_owner_.get(), owner.get()}) {
+        for (; obj; obj = obj->render_cache_owner_.get())
+            obj->is_render_cache_dirty_ = true;
+    }
+
+    render_cache_owner_ = std::move(owner);
+
+    for (auto& child : get_children())
+        child.update_render_cache_owner_();
+}
+
+const frame* frame::get_active_render_cache_() const {
+    if (is_rendering_cache_)
+        return this;
+
+    if (render_cache_owner_ && render_cache_owner_->is_rendering_cache_)
+        return render_cache_owner_.get();
+
+    return nullptr;
+}
+
+void frame::update_render_cache() {
+    if (!is_render_cached_ || !is_render_cache_dirty_ || is_virtual_ || !is_visible() ||
+        !is_valid_)
+        return;
+
+    const vector2f size = get_apparent_dimensions();
+    if (size.x <= 0 || size.y <= 0)
+        return;
+
+    auto&       rdr         = get_manager().get_renderer();
+    const float factor      = get_manager().get_interface_scaling_factor();
+    vector2ui   scaled_size = vector2ui(std::round(size.x * factor), std::round(size.y * factor));
+
+    try {
+        if (render_cache_target_)
+            render_cache_target_->set_dimensions(scaled_size);
+        else
+            render_cache_target_ = rdr.create_render_target(scaled_size);
+    } catch (const utils::exception& e) {
+        gui::out << gui::error << "gui::frame: "
+                 << "Unable to create render_target for caching \"" << get_name() << "\": "
+                 << e.get_description() << std::endl;
+
+        set_render_cached(false);
+        return;
+    }
+
+    if (!render_cache_target_) {
+        set_render_cached(false);
+        return;
+    }
+
+    // Gather the frames to render in the bitmap. Children of other cached frames are
+    // rendered in the bitmap of these frames, which is then rendered here as a single quad.
+    std::vector<const frame*> frame_list;
+    std::vector<const frame*> frame_stack = {this};
+    while (!frame_stack.empty()) {
+        const frame* obj = frame_stack.back();
+        frame_stack.pop_back();
+
+        for (const auto& child : obj->get_children()) {
+            if (child.is_virtual())
+                continue;
+
+            if (child.is_in_render_cache())
+                frame_list.push_back(&child);
+
+            if (!child.is_render_cached_)
+                frame_stack.push_back(&child);
+        }
+    }
+
+    // Sort them as a frame renderer would
+    std::stable_sort(frame_list.begin(), frame_list.end(), [](const frame* f1, const frame* f2) {
+        if (f1->get_effective_strata() != f2->get_effective_strata())
+            return f1->get_effective_strata() < f2->get_effective_strata();
+        return f1->get_level() < f2->get_level();
+    });
+
+    rdr.begin(render_cache_target_);
+
+    vector2f view = vector2f(render_cache_target_->get_canvas_dimensions()) / factor;
+    rdr.set_view(matrix4f::translation(-borders_.top_left()) * matrix4f::view(view));
+
+    render_cache_target_->clear(color::empty);
+
+    is_rendering_cache_ = true;
+
+    render_(&borders_);
+    for (const auto* obj : frame_list)
+        obj->render_cached_or_direct_(&borders_);
+
+    is_rendering_cache_ = false;
+
+    rdr.end();
+
+    render_cache_quad_.mat      = rdr.create_material(render_cache_target_);
+    render_cache_quad_.v[0].pos = borders_.top_left();
+    render_cache_quad_.v[1].pos = borders_.top_right();
+    render_cache_quad_.v[2].pos = borders_.bottom_right();
+    render_cache_quad_.v[3].pos = borders_.bottom_left();
+
+    render_cache_quad_.v[0].uvs = render_cache_quad_.mat->get_canvas_uv(vector2f(0, 0), true);
+    render_cache_quad_.v[1].uvs = render_cache_quad_.mat->get_canvas_uv(vector2f(1, 0), true);
+    render_cache_quad_.v[2].uvs = render_cache_quad_.mat->get_canvas_uv(vector2f(1, 1), true);
+    render_cache_quad_.v[3].uvs = render_cache_quad_.mat->get_canvas_uv(vector2f(0, 1), true);
+
+    is_render_cache_dirty_ = false;
+
+    // Frame renderers with their own render target may have rendered the previous bitmap
+    get_effective_frame_renderer()->notify_strata_needs_redraw(get_effective_strata());
 }
 
 int frame::get_level() const {
@@ -820,10 +1249,12 @@ bool frame::is_in_region(const vector2f& position) const {
     if (title_region_ && title_region_->is_in_region(position))
         return true;
 
-    bool is_in_x_range = borders_.left + abs_hit_rect_inset_list_.left <= position.x &&
-                         position.x <= borders_.right - abs_hit_rect_inset_list_.right - 1.0f;
-    bool is_in_y_range = borders_.top + abs_hit_rect_inset_list_.top <= position.y &&
-                         position.y <= borders_.bottom - abs_hit_rect_inset_list_.bottom - 1.0f;
+    const vector2f pos = to_local_position(position);
+
+    bool is_in_x_range = borders_.left + abs_hit_rect_inset_list_.left <= pos.x &&
+                         pos.x <= borders_.right - abs_hit_rect_inset_list_.right - 1.0f;
+    bool is_in_y_range = borders_.top + abs_hit_rect_inset_list_.top <= pos.y &&
+                         pos.y <= borders_.bottom - abs_hit_rect_inset_list_.bottom - 1.0f;
 
     return is_in_x_range && is_in_y_range;
 }
@@ -995,8 +1426,18 @@ utils::connection frame::define_script_(
     bool                    append,
     const script_info&      info) {
 
-    auto wrapped_handler = [handler = std::move(handler),
-                            info](frame& self, const event_data& args) {
+    // The handler and its source information are shared by all the copies of this function
+    // (e.g., when this script is inherited by instances of a virtual frame)
+    struct lua_handler {
+        sol::protected_function function;
+        script_info             info;
+    };
+
+    auto shared_handler =
+        std::make_shared<const lua_handler>(lua_handler{std::move(handler), info});
+
+    auto wrapped_handler = [shared_handler = std::move(shared_handler)](
+                               frame& self, const event_data& args) {
         sol::state& lua     = self.get_manager().get_lua();
         lua_State*  lua_raw = lua.lua_state();
 
@@ -1017,14 +1458,15 @@ utils::connection frame::define_script_(
             throw gui::exception("Lua glue object is nil");
 
         // Call the function
-        auto result = handler(self_lua, sol::as_args(lua_args));
+        auto result = shared_handler->function(self_lua, sol::as_args(lua_args));
         // WARNING: after this point, the frame (self_lua) may be deleted.
         // Do not use any member variable or member function directly.
 
         // Handle errors
         if (!result.valid()) {
             throw gui::exception(hijack_sol_error_message(
-                result.get<sol::error>().what(), info.file_name, info.line_nbr));
+                result.get<sol::error>().what(), shared_handler->info.file_name,
+                shared_handler->info.line_nbr));
         }
     };
 
@@ -1151,6 +1593,89 @@ float frame::get_update_rate() const {
     return update_rate_;
 }
 
+animation_group& frame::add_animation_group(const std::string& name) {
+    auto iter = utils::find_if(
+        animation_group_list_, [&](const auto& group) { return group->get_name() == name; });
+
+    if (iter != animation_group_list_.end()) {
+        gui::out << gui::warning << "gui::" << get_region_type() << ": \"" << name_
+                 << "\" already has an animation group named \"" << name
+                 << "\". Replacing it." << std::endl;
+
+        (*iter)->reset();
+        *iter = std::make_unique<animation_group>(*this, name);
+        return **iter;
+    }
+
+    animation_group_list_.push_back(std::make_unique<animation_group>(*this, name));
+    return *animation_group_list_.back();
+}
+
+animation_group* frame::get_animation_group(const std::string& name) {
+    auto iter = utils::find_if(
+        animation_group_list_, [&](const auto& group) { return group->get_name() == name; });
+
+    return iter != animation_group_list_.end() ? iter->get() : nullptr;
+}
+
+const animation_group* frame::get_animation_group(const std::string& name) const {
+    auto iter = utils::find_if(
+        animation_group_list_, [&](const auto& group) { return group->get_name() == name; });
+
+    return iter != animation_group_list_.end() ? iter->get() : nullptr;
+}
+
+void frame::play_animation(const std::string& name) {
+    auto* group = get_animation_group(name);
+    if (!group) {
+        gui::out << gui::warning << "gui::" << get_region_type() << ": \"" << name_
+                 << "\" has no animation group named \"" << name << "\"." << std::endl;
+        return;
+    }
+
+    group->play();
+}
+
+void frame::stop_animation(const std::string& name) {
+    if (auto* group = get_animation_group(name))
+        group->stop();
+}
+
+bool frame::is_animation_playing(const std::string& name) const {
+    const auto* group = get_animation_group(name);
+    return group && group->is_playing();
+}
+
+bool frame::is_animation_playing() const {
+    for (const auto& group : animation_group_list_) {
+        if (group->is_playing())
+            return true;
+    }
+
+    return false;
+}
+
+void frame::update_animations(float delta) {
+    alive_checker checker(*this);
+
+    // NB: scripts may add new groups; these will be updated next time
+    const std::size_t group_count = animation_group_list_.size();
+    for (std::size_t i = 0u; i < group_count && i < animation_group_list_.size(); ++i) {
+        auto& group = *animation_group_list_[i];
+        if (!group.is_playing() || group.update(delta))
+            continue;
+
+        const std::string group_name = group.get_name();
+        fire_script("OnAnimationFinished", {group_name});
+        if (!checker.is_alive())
+            return;
+    }
+}
+
+void frame::notify_animation_started_() {
+    get_manager().get_root().register_animated_frame(*this);
+}
+
 void frame::enable_drag(const std::string& button_name) {
     reg_drag_list_.insert(button_name);
 }
@@ -1274,9 +1799,11 @@ void frame::set_resizable(bool is_resizable) {
 }
 
 void frame::set_scale(float scale) {
+    if (scale_ == scale)
+        return;
+
     scale_ = scale;
-    if (scale_ != scale)
-        notify_renderer_need_redraw();
+    update_effective_scale_();
 }
 
 void frame::set_top_level(bool is_top_level) {
@@ -1482,12 +2009,24 @@ void frame::notify_renderer_need_redraw() {
     if (is_virtual_)
         return;
 
+    is_render_bounds_dirty_ = true;
+
+    // Cached bitmaps including this frame must be rendered again
+    if (is_render_cached_)
+        is_render_cache_dirty_ = true;
+
+    for (frame* obj = render_cache_owner_.get(); obj; obj = obj->render_cache_owner_.get())
+        obj->is_render_cache_dirty_ = true;
+
     get_effective_frame_renderer()->notify_strata_needs_redraw(get_effective_strata());
 }
 
 void frame::notify_scaling_factor_updated() {
     base::notify_scaling_factor_updated();
 
+    if (is_render_cached_)
+        is_render_cache_dirty_ = true;
+
     if (title_region_)
         title_region_->notify_scaling_factor_updated();
 
@@ -1516,11 +2055,8 @@ void frame::notify_mouse_in_frame(bool mouse_in_frame, const vector2f& /*positio
     }
 }
 
-void frame::update_borders_() {
-    const bool old_valid       = is_valid_;
-    const auto old_border_list = borders_;
-
-    base::update_borders_();
+void frame::notify_borders_updated_(const bounds2f& old_border_list, bool old_valid) {
+    base::notify_borders_updated_(old_border_list, old_valid);
 
     check_position_();
 
@@ -88,8 +88,18 @@
  * In layout files "scripts" handlers, they can be accessed with the
  * hard-coded generic names `arg1`, `arg2`, etc.
  *
+ * Mouse positions provided to hard-coded events are in the same coordinates
+ * as the borders of the frame (see @{Region:get_left}, etc.). These are the
+ * screen coordinates, except inside a @{ScrollFrame} with translation-only
+ * scrolling, where the scroll offset is not applied to the borders.
+ *
  * Hard-coded events available to all @{Frame}s:
  *
+ * - `OnAnimationFinished`: Triggered when one of the frame's animation groups
+ * reaches its end (see @{Frame:play_animation}). Not triggered for looping
+ * groups, or when the group is stopped with @{Frame:stop_animation}. This
+ * event provides one argument to the registered callback: the name of the
+ * animation group.
  * - `OnChar`: Triggered whenever a character is typed and the frame has focus
  * (see @{Frame:set_focus}).
  * - `OnDoubleClick`: Triggered when the frame is double-clicked.
@@ -555,6 +565,14 @@ void frame::register_on_lua(sol::state& lua) {
      */
     type.set_function("has_script", member_function<&frame::has_script>());
 
+    /** @function is_animation_playing
+     */
+    type.set_function(
+        "is_animation_playing", [](const frame& self, sol::optional<std::string> name) {
+            return name.has_value() ? self.is_animation_playing(name.value())
+                                    : self.is_animation_playing();
+        });
+
     /** @function is_auto_focus
      */
     type.set_function("is_auto_focus", member_function<&frame::is_auto_focus_enabled>());
@@ -587,6 +605,10 @@ void frame::register_on_lua(sol::state& lua) {
      */
     type.set_function("is_movable", member_function<&frame::is_movable>());
 
+    /** @function is_render_cached
+     */
+    type.set_function("is_render_cached", member_function<&frame::is_render_cached>());
+
     /** @function is_resizable
      */
     type.set_function("is_resizable", member_function<&frame::is_resizable>());
@@ -599,6 +621,10 @@ void frame::register_on_lua(sol::state& lua) {
      */
     type.set_function("is_user_placed", member_function<&frame::is_user_placed>());
 
+    /** @function play_animation
+     */
+    type.set_function("play_animation", member_function<&frame::play_animation>());
+
     /** @function raise
      */
     type.set_function("raise", member_function<&frame::raise>());
@@ -786,6 +812,10 @@ void frame::register_on_lua(sol::state& lua) {
      */
     type.set_function("set_movable", member_function<&frame::set_movable>());
 
+    /** @function set_render_cached
+     */
+    type.set_function("set_render_cached", member_function<&frame::set_render_cached>());
+
     /** @function set_resizable
      */
     type.set_function("set_resizable", member_function<&frame::set_resizable>());
@@ -827,6 +857,10 @@ void frame::register_on_lua(sol::state& lua) {
         self.start_sizing(utils::from_string<point>(p).value());
     });
 
+    /** @function stop_animation
+     */
+    type.set_function("stop_animation", member_function<&frame::stop_animation>());
+
     /** @function stop_moving_or_sizing
      */
     type.set_function("stop_moving_or_sizing", [](frame& self) {
@@ -1,3 +1,4 @@
+#include "lxgui/gui_animation.hpp"
 #include "lxgui/gui_backdrop.hpp"
 #include "lxgui/gui_frame.hpp"
 #include "lxgui/gui_layered_region.hpp"
@@ -22,6 +23,7 @@ void frame::parse_all_nodes_before_children_(const layout_node& node) {
     parse_hit_rect_insets_node_(node);
 
     parse_layers_node_(node);
+    parse_animations_node_(node);
 }
 
 void frame::parse_layout(const layout_node& node) {
@@ -77,6 +79,8 @@ void frame::parse_attributes_(const layout_node& node) {
         enable_auto_focus(attr.value());
     if (const auto attr = node.try_get_attribute_value<float>("updateRate"))
         set_update_rate(attr.value());
+    if (const auto attr = node.try_get_attribute_value<bool>("renderCached"))
+        set_render_cached(attr.value());
 }
 
 void frame::parse_resize_bounds_node_(const layout_node& node) {
@@ -357,6 +361,91 @@ void frame::parse_layers_node_(const layout_node& node) {
     }
 }
 
+void frame::parse_animations_node_(const layout_node& node) {
+    const layout_node* animations_node = node.try_get_child("Animations");
+    if (!animations_node)
+        return;
+
+    for (const layout_node& group_node : animations_node->get_children()) {
+        if (group_node.get_name() != "AnimationGroup") {
+            gui::out << gui::warning << group_node.get_location() << ": "
+                     << "unexpected node '" << group_node.get_name() << "'; ignored."
+                     << std::endl;
+            continue;
+        }
+
+        auto& group = add_animation_group(group_node.get_attribute_value<std::string>("name"));
+
+        if (const auto attr = group_node.try_get_attribute_value<animation_looping>("looping"))
+            group.set_looping(attr.value());
+
+        if (const auto attr = group_node.try_get_attribute_value<bool>("keepFinalState"))
+            group.set_keep_final_state(attr.value());
+
+        for (const layout_node& anim_node : group_node.get_children()) {
+            animation anim;
+
+            const std::string& type = anim_node.get_name();
+            if (type == "Alpha") {
+                anim.type       = animation_type::alpha;
+                anim.from_alpha = anim_node.get_attribute_value_or<float>("fromAlpha", 1.0f);
+                anim.to_alpha   = anim_node.get_attribute_value_or<float>("toAlpha", 1.0f);
+            } else if (type == "Translation") {
+                anim.type   = animation_type::translation;
+                anim.offset = vector2f(
+                    anim_node.get_attribute_value_or<float>("offsetX", 0.0f),
+                    anim_node.get_attribute_value_or<float>("offsetY", 0.0f));
+            } else if (type == "Scale") {
+                anim.type       = animation_type::scale;
+                anim.from_scale = vector2f(
+                    anim_node.get_attribute_value_or<float>("fromScaleX", 1.0f),
+                    anim_node.get_attribute_value_or<float>("fromScaleY", 1.0f));
+                anim.to_scale = vector2f(
+                    anim_node.get_attribute_value_or<float>("toScaleX", 1.0f),
+                    anim_node.get_attribute_value_or<float>("toScaleY", 1.0f));
+            } else if (type == "Rotation") {
+                anim.type    = animation_type::rotation;
+                anim.degrees = anim_node.get_attribute_value_or<float>("degrees", 0.0f);
+            } else if (type == "Color") {
+                anim.type = animation_type::color;
+                if (const layout_node* color_node = anim_node.try_get_child("FromColor"))
+                    anim.from_color = parse_color_node_(*color_node);
+                if (const layout_node* color_node = anim_node.try_get_child("ToColor"))
+                    anim.to_color = parse_color_node_(*color_node);
+            } else if (type == "TexCoords") {
+                anim.type = animation_type::tex_coords;
+
+                auto parse_rect = [](const layout_node& rect_node) {
+                    return std::array<float, 4>{
+                        rect_node.get_attribute_value_or<float>("left", 0.0f),
+                        rect_node.get_attribute_value_or<float>("top", 0.0f),
+                        rect_node.get_attribute_value_or<float>("right", 1.0f),
+                        rect_node.get_attribute_value_or<float>("bottom", 1.0f)};
+                };
+
+                if (const layout_node* rect_node = anim_node.try_get_child("FromTexCoords"))
+                    anim.from_tex_rect = parse_rect(*rect_node);
+                if (const layout_node* rect_node = anim_node.try_get_child("ToTexCoords"))
+                    anim.to_tex_rect = parse_rect(*rect_node);
+            } else {
+                gui::out << gui::warning << anim_node.get_location() << ": "
+                         << "unexpected node '" << type << "'; ignored." << std::endl;
+                continue;
+            }
+
+            anim.target      = anim_node.get_attribute_value_or<std::string>("target", "");
+            anim.order       = anim_node.get_attribute_value_or<std::size_t>("order", 1u);
+            anim.duration    = anim_node.get_attribute_value_or<float>("duration", 0.0f);
+            anim.start_delay = anim_node.get_attribute_value_or<float>("startDelay", 0.0f);
+            anim.end_delay   = anim_node.get_attribute_value_or<float>("endDelay", 0.0f);
+            anim.smoothing   = anim_node.get_attribute_value_or<animation_smoothing>(
+                "smoothing", animation_smoothing::none);
+
+            group.add_animation(std::move(anim));
+        }
+    }
+}
+
 utils::observer_ptr<frame> frame::parse_child_(const layout_node& node, const std::string& type) {
     try {
         auto attr = parse_core_attributes(
@@ -158,6 +158,22 @@ frame_renderer::find_topmost_frame(const std::function<bool(const frame&)>& pred
     return nullptr;
 }
 
+utils::observer_ptr<const frame> frame_renderer::find_topmost_frame_(
+    const std::function<bool(const frame&)>& predicate, const bounds2f& clip_bounds) const {
+    for (const auto* obj : utils::range::reverse(sorted_frame_list_)) {
+        if (obj->is_visible() && obj->get_borders().overlaps(clip_bounds)) {
+            if (auto topmost = obj->find_topmost_frame(predicate))
+                return topmost;
+        }
+    }
+
+    return nullptr;
+}
+
+vector2f frame_renderer::get_render_offset() const {
+    return vector2f::zero;
+}
+
 int frame_renderer::get_highest_level(strata strata_id) const {
     auto range = strata_list_[static_cast<std::size_t>(strata_id)].range;
     auto begin = sorted_frame_list_.begin() + range.first;
@@ -180,6 +196,17 @@ void frame_renderer::render_strata_(const strata_data& strata_obj) const {
     }
 }
 
+void frame_renderer::render_strata_(
+    const strata_data& strata_obj, const bounds2f& clip_bounds) const {
+    auto begin = sorted_frame_list_.begin() + strata_obj.range.first;
+    auto end   = sorted_frame_list_.begin() + strata_obj.range.second;
+
+    for (auto iter = begin; iter != end; ++iter) {
+        // Frames and regions that would not be visible are skipped
+        (*iter)->render(clip_bounds);
+    }
+}
+
 void frame_renderer::clear_strata_list_() {
     sorted_frame_list_.clear();
     frame_list_updated_ = true;
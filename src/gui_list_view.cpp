@@ -0,0 +1,316 @@
+#include "lxgui/gui_list_view.hpp"
+
+#include "lxgui/gui_alive_checker.hpp"
+#include "lxgui/gui_event_emitter.hpp"
+#include "lxgui/gui_frame.hpp"
+#include "lxgui/gui_manager.hpp"
+#include "lxgui/gui_out.hpp"
+#include "lxgui/gui_region_tpl.hpp"
+#include "lxgui/gui_virtual_registry.hpp"
+#include "lxgui/gui_virtual_root.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+namespace lxgui::gui {
+
+list_view::list_view(
+    utils::control_block& block, manager& mgr, const frame_core_attributes& attr) :
+    scroll_frame(block, mgr, attr) {
+
+    initialize_(*this, attr);
+
+    // Row frames are re-anchored only when rows are recycled, not when scrolling
+    is_translation_scroll_enabled_ = true;
+}
+
+std::string list_view::serialize(const std::string& tab) const {
+    std::ostringstream str;
+
+    str << base::serialize(tab);
+    str << tab << "  # Row template: " << row_template_ << "\n";
+    str << tab << "  # Row count   : " << row_count_ << "\n";
+    str << tab << "  # Row height  : " << get_row_height() << "\n";
+    str << tab << "  # Row frames  : " << row_slot_list_.size() << "\n";
+
+    return str.str();
+}
+
+void list_view::copy_from(const region& obj) {
+    base::copy_from(obj);
+
+    const list_view* list_obj = down_cast<list_view>(&obj);
+    if (!list_obj)
+        return;
+
+    row_binder_ = list_obj->row_binder_;
+
+    this->set_overscan(list_obj->get_overscan());
+    this->set_row_height(list_obj->row_height_);
+    this->set_row_template(list_obj->get_row_template());
+    this->set_row_count(list_obj->get_row_count());
+}
+
+void list_view::fire_script(const std::string& script_name, const event_data& data) {
+    if (!is_loaded())
+        return;
+
+    alive_checker checker(*this);
+    base::fire_script(script_name, data);
+    if (!checker.is_alive())
+        return;
+
+    if (script_name == "OnVerticalScroll" || script_name == "OnSizeChanged")
+        update_rows_(false);
+}
+
+void list_view::notify_loaded() {
+    base::notify_loaded();
+
+    update_rows_(true);
+}
+
+void list_view::set_row_template(const std::string& inheritance) {
+    if (row_template_ == inheritance)
+        return;
+
+    row_template_ = inheritance;
+
+    clear_rows_();
+    update_rows_(true);
+}
+
+const std::string& list_view::get_row_template() const {
+    return row_template_;
+}
+
+void list_view::set_row_count(std::size_t row_count) {
+    row_count_ = row_count;
+
+    update_rows_(true);
+}
+
+std::size_t list_view::get_row_count() const {
+    return row_count_;
+}
+
+void list_view::set_row_height(float row_height) {
+    if (row_height_ == row_height)
+        return;
+
+    row_height_ = row_height;
+
+    clear_rows_();
+    update_rows_(true);
+}
+
+float list_view::get_row_height() const {
+    return row_height_ > 0.0f ? row_height_ : template_row_height_;
+}
+
+void list_view::set_overscan(std::size_t overscan) {
+    if (overscan_ == overscan)
+        return;
+
+    overscan_ = overscan;
+
+    update_rows_(false);
+}
+
+std::size_t list_view::get_overscan() const {
+    return overscan_;
+}
+
+void list_view::set_row_binder(row_binder binder) {
+    row_binder_ = std::move(binder);
+
+    refresh_rows();
+}
+
+void list_view::refresh_rows() {
+    update_rows_(true);
+}
+
+utils::observer_ptr<frame> list_view::get_row_frame(std::size_t row_index) {
+    if (row_slot_list_.empty())
+        return nullptr;
+
+    const auto& slot = row_slot_list_[row_index % row_slot_list_.size()];
+    if (slot.row_index != row_index)
+        return nullptr;
+
+    return slot.row_frame;
+}
+
+std::size_t list_view::get_row_index(const frame& row_frame) const {
+    for (const auto& slot : row_slot_list_) {
+        if (slot.row_frame.get() == &row_frame)
+            return slot.row_index;
+    }
+
+    return no_row;
+}
+
+void list_view::create_content_() {
+    if (content_ || is_virtual())
+        return;
+
+    auto content = create_child<frame>("$parentContent");
+    if (!content)
+        return;
+
+    content->set_manually_inherited(true);
+    content->notify_loaded();
+    content_ = content;
+
+    update_content_size_();
+    set_scroll_child(remove_child(content));
+}
+
+void list_view::clear_rows_() {
+    for (auto& slot : row_slot_list_) {
+        if (slot.row_frame)
+            slot.row_frame->destroy();
+    }
+
+    row_slot_list_.clear();
+    template_row_height_ = 0.0f;
+}
+
+void list_view::update_content_size_() {
+    if (!content_)
+        return;
+
+    content_->set_dimensions(vector2f(
+        get_apparent_dimensions().x, static_cast<float>(row_count_) * get_row_height()));
+}
+
+utils::observer_ptr<frame> list_view::create_row_(std::size_t slot) {
+    frame_core_attributes attr;
+    attr.name        = "$parentRow" + std::to_string(slot + 1u);
+    attr.inheritance = get_manager().get_virtual_root().get_registry().get_virtual_region_list(
+        row_template_);
+
+    if (attr.inheritance.empty())
+        attr.object_type = frame::class_name;
+    else
+        attr.object_type = attr.inheritance.front()->get_region_type();
+
+    auto row = content_->create_child(std::move(attr));
+    if (!row)
+        return nullptr;
+
+    row->clear_all_anchors();
+    row->set_anchor(point::top_left, vector2f::zero);
+    row->set_anchor(point::top_right, vector2f::zero);
+
+    if (row_height_ > 0.0f)
+        row->set_height(row_height_);
+    else if (template_row_height_ <= 0.0f)
+        template_row_height_ = row->get_dimensions().y;
+
+    row->notify_loaded();
+    return row;
+}
+
+void list_view::update_rows_(bool rebind_all) {
+    if (is_virtual() || !is_loaded() || row_template_.empty())
+        return;
+
+    create_content_();
+    if (!content_)
+        return;
+
+    std::size_t slot_count = 0u;
+    if (row_count_ != 0u) {
+        // Create a first row to get the height from the template, if needed
+        if (get_row_height() <= 0.0f && row_slot_list_.empty())
+            row_slot_list_.push_back(row_slot{create_row_(0u), no_row});
+
+        const float row_height = get_row_height();
+        if (row_height <= 0.0f) {
+            gui::out << gui::warning << "gui::" << get_region_type() << ": "
+                     << "Cannot display rows of \"" << get_name()
+                     << "\": the row height is not defined." << std::endl;
+            return;
+        }
+
+        // Enough rows to fill the visible area, even when partially scrolled, plus overscan
+        const float view_height = get_apparent_dimensions().y;
+        slot_count = static_cast<std::size_t>(std::ceil(view_height / row_height)) + 1u;
+        slot_count = std::min(slot_count + 2u * overscan_, row_count_);
+    }
+
+    if (slot_count != row_slot_list_.size()) {
+        // The slot displaying each row depends on the number of slots; rebind all rows
+        while (row_slot_list_.size() > slot_count) {
+            if (auto& row_frame = row_slot_list_.back().row_frame)
+                row_frame->destroy();
+
+            row_slot_list_.pop_back();
+        }
+
+        while (row_slot_list_.size() < slot_count) {
+            row_slot_list_.push_back(row_slot{create_row_(row_slot_list_.size()), no_row});
+        }
+
+        rebind_all = true;
+    }
+
+    update_content_size_();
+
+    if (slot_count == 0u)
+        return;
+
+    std::size_t first_row =
+        static_cast<std::size_t>(std::max(0.0f, std::floor(scroll_.y / get_row_height())));
+    first_row = first_row > overscan_ ? first_row - overscan_ : 0u;
+    first_row = std::min(first_row, row_count_ - slot_count);
+
+    alive_checker checker(*this);
+    for (std::size_t row_index = first_row; row_index < first_row + slot_count; ++row_index) {
+        const std::size_t slot = row_index % slot_count;
+        if (!rebind_all && row_slot_list_[slot].row_index == row_index)
+            continue;
+
+        bind_row_(slot, row_index);
+        if (!checker.is_alive())
+            return;
+    }
+}
+
+void list_view::bind_row_(std::size_t slot, std::size_t row_index) {
+    auto& slot_obj     = row_slot_list_[slot];
+    slot_obj.row_index = row_index;
+
+    frame* row = slot_obj.row_frame.get();
+    if (!row)
+        return;
+
+    const vector2f offset(0.0f, static_cast<float>(row_index) * get_row_height());
+    row->modify_anchor(point::top_left).offset  = offset;
+    row->modify_anchor(point::top_right).offset = offset;
+    row->notify_borders_need_update();
+
+    if (!row_binder_)
+        return;
+
+    // Make a copy of useful objects: the binder may delete this list_view
+    const row_binder binder        = row_binder_;
+    auto&            event_emitter = get_manager().get_event_emitter();
+
+    try {
+        binder(*this, *row, row_index);
+    } catch (const std::exception& e) {
+        std::string err = e.what();
+        gui::out << gui::error << err << std::endl;
+        event_emitter.fire_event("LUA_ERROR", {err});
+    }
+}
+
+const std::vector<std::string>& list_view::get_type_list_() const {
+    return get_type_list_impl_<list_view>();
+}
+
+} // namespace lxgui::gui
@@ -0,0 +1,122 @@
+#include "lxgui/gui_list_view.hpp"
+#include "lxgui/gui_manager.hpp"
+#include "lxgui/gui_out.hpp"
+#include "lxgui/gui_region_tpl.hpp"
+
+#include <lxgui/extern_sol2_protected_function.hpp>
+#include <lxgui/extern_sol2_state.hpp>
+
+/** A @{ScrollFrame} displaying a long list of rows.
+ * The rows all share the same layout, defined by a "row template" (a list of
+ * virtual frames to inherit from), and the same height. The content of each
+ * row is filled by a "row binder" function, registered with
+ * @{ListView:set_row_binder}, which receives the list view, the row frame,
+ * and the index of the row to display (starting at 1).
+ *
+ * Only the rows that are visible are actually created: when scrolling,
+ * rows which move out of view are recycled to display the rows that move
+ * into view, and the row binder is called again to update their content.
+ * Rows should therefore not store any state that is not set by the row binder.
+ *
+ * The scroll child is created and managed by the list view, and must not
+ * be changed.
+ *
+ * Inherits all methods from: @{Region}, @{Frame}, @{ScrollFrame}.
+ *
+ * Child classes: none.
+ * @classmod ListView
+ */
+
+namespace lxgui::gui {
+
+void list_view::register_on_lua(sol::state& lua) {
+    auto type = lua.new_usertype<list_view>(
+        list_view::class_name, sol::base_classes, sol::bases<region, frame, scroll_frame>(),
+        sol::meta_function::index, member_function<&list_view::get_lua_member_>(),
+        sol::meta_function::new_index, member_function<&list_view::set_lua_member_>());
+
+    /** @function get_overscan
+     */
+    type.set_function("get_overscan", member_function<&list_view::get_overscan>());
+
+    /** @function get_row_count
+     */
+    type.set_function("get_row_count", member_function<&list_view::get_row_count>());
+
+    /** @function get_row_frame
+     */
+    type.set_function("get_row_frame", [](list_view& self, std::size_t row_index) {
+        sol::object row;
+        if (row_index == 0u)
+            return row;
+
+        if (auto* row_frame = self.get_row_frame(row_index - 1u).get())
+            row = self.get_manager().get_lua()[row_frame->get_name()];
+
+        return row;
+    });
+
+    /** @function get_row_height
+     */
+    type.set_function("get_row_height", member_function<&list_view::get_row_height>());
+
+    /** @function get_row_index
+     */
+    type.set_function(
+        "get_row_index",
+        [](const list_view& self, const frame& row_frame) -> sol::optional<std::size_t> {
+            const std::size_t row_index = self.get_row_index(row_frame);
+            if (row_index == list_view::no_row)
+                return sol::nullopt;
+
+            return row_index + 1u;
+        });
+
+    /** @function get_row_template
+     */
+    type.set_function("get_row_template", member_function<&list_view::get_row_template>());
+
+    /** @function refresh_rows
+     */
+    type.set_function("refresh_rows", member_function<&list_view::refresh_rows>());
+
+    /** @function set_overscan
+     */
+    type.set_function("set_overscan", member_function<&list_view::set_overscan>());
+
+    /** @function set_row_binder
+     */
+    type.set_function(
+        "set_row_binder", [](list_view& self, sol::optional<sol::protected_function> binder) {
+            if (!binder.has_value()) {
+                self.set_row_binder(nullptr);
+                return;
+            }
+
+            self.set_row_binder([function = std::move(binder.value())](
+                                    list_view& list, frame& row, std::size_t row_index) {
+                sol::state& lua = list.get_manager().get_lua();
+
+                sol::object list_lua = lua[list.get_name()];
+                sol::object row_lua  = lua[row.get_name()];
+
+                auto result = function(list_lua, row_lua, row_index + 1u);
+                if (!result.valid())
+                    throw gui::exception(result.get<sol::error>().what());
+            });
+        });
+
+    /** @function set_row_count
+     */
+    type.set_function("set_row_count", member_function<&list_view::set_row_count>());
+
+    /** @function set_row_height
+     */
+    type.set_function("set_row_height", member_function<&list_view::set_row_height>());
+
+    /** @function set_row_template
+     */
+    type.set_function("set_row_template", member_function<&list_view::set_row_template>());
+}
+
+} // namespace lxgui::gui
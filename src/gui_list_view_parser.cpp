@@ -0,0 +1,20 @@
+#include "lxgui/gui_layout_node.hpp"
+#include "lxgui/gui_list_view.hpp"
+#include "lxgui/gui_out.hpp"
+
+namespace lxgui::gui {
+
+void list_view::parse_attributes_(const layout_node& node) {
+    scroll_frame::parse_attributes_(node);
+
+    if (const auto attr = node.try_get_attribute_value<float>("rowHeight"))
+        set_row_height(attr.value());
+    if (const auto attr = node.try_get_attribute_value<std::size_t>("overscan"))
+        set_overscan(attr.value());
+    if (const auto attr = node.try_get_attribute_value<std::string>("rowTemplate"))
+        set_row_template(attr.value());
+    if (const auto attr = node.try_get_attribute_value<std::size_t>("rowCount"))
+        set_row_count(attr.value());
+}
+
+} // namespace lxgui::gui
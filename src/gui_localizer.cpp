@@ -7,6 +7,7 @@
 #include "lxgui/utils_string.hpp"
 #include "lxgui/utils_variant.hpp"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <fmt/args.h>
@@ -34,6 +35,60 @@ std::string get_environment_variable(const std::string& name) {
 #endif
 }
 
+template<typename T>
+utils::variant to_variant(T&& arg) {
+    utils::variant variant;
+    if (!arg.template is<sol::lua_nil_t>())
+        variant = arg;
+
+    return variant;
+}
+
+std::size_t hash_arguments(const void* tmpl, const std::vector<utils::variant>& args) {
+    std::size_t hash = std::hash<const void*>{}(tmpl);
+    for (const auto& arg : args) {
+        std::size_t arg_hash = std::visit(
+            [](const auto& value) -> std::size_t {
+                using inner_type = std::decay_t<decltype(value)>;
+                if constexpr (std::is_same_v<inner_type, utils::empty>)
+                    return 0u;
+                else
+                    return std::hash<inner_type>{}(value);
+            },
+            arg);
+
+        hash ^= arg_hash + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+
+    return hash;
+}
+
+bool are_arguments_equal(
+    const std::vector<utils::variant>& args1, const std::vector<utils::variant>& args2) {
+    if (args1.size() != args2.size())
+        return false;
+
+    for (std::size_t i = 0; i < args1.size(); ++i) {
+        if (args1[i].index() != args2[i].index())
+            return false;
+
+        const bool equal = std::visit(
+            [&](const auto& value) {
+                using inner_type = std::decay_t<decltype(value)>;
+                if constexpr (std::is_same_v<inner_type, utils::empty>)
+                    return true;
+                else
+                    return value == std::get<inner_type>(args2[i]);
+            },
+            args1[i]);
+
+        if (!equal)
+            return false;
+    }
+
+    return true;
+}
+
 std::vector<std::string> get_default_languages() {
     // First try parsing the LANGUAGE environment variable.
     // This is the best, because it lets the user specify a list of languages
@@ -752,11 +807,19 @@ void localizer::load_translation_file(const std::string& file_name) try {
             return;
         std::string ks = key.as<std::string>();
 
-        if (value.is<std::string>())
-            map_.insert(std::make_pair(std::hash<std::string>{}(ks), value.as<std::string>()));
-        else if (value.is<sol::protected_function>())
-            map_.insert(
-                std::make_pair(std::hash<std::string>{}(ks), value.as<sol::protected_function>()));
+        // Keep the first translation loaded for a given key
+        if (find_key_("{" + ks + "}") != map_.end())
+            return;
+
+        const hash_type hash = std::hash<std::string_view>{}(ks);
+        if (value.is<std::string>()) {
+            map_.insert(std::make_pair(
+                hash,
+                translation{std::move(ks), compile_template_(value.as<std::string>())}));
+        } else if (value.is<sol::protected_function>()) {
+            map_.insert(std::make_pair(
+                hash, translation{std::move(ks), value.as<sol::protected_function>()}));
+        }
     });
 
     // Keep a copy so variables/functions remain alive
@@ -768,6 +831,18 @@ void localizer::load_translation_file(const std::string& file_name) try {
 
 void localizer::clear_translations() {
     map_.clear();
+
+    for (auto& entry : cache_)
+        entry = cache_entry{};
+}
+
+void localizer::set_translation_cache_size(std::size_t size) {
+    cache_.clear();
+    cache_.resize(size);
+}
+
+std::size_t localizer::get_translation_cache_size() const {
+    return cache_.size();
 }
 
 bool localizer::is_key_valid_(std::string_view key) const {
@@ -776,18 +851,151 @@ bool localizer::is_key_valid_(std::string_view key) const {
 
 localizer::map_type::const_iterator localizer::find_key_(std::string_view key) const {
     auto substring = key.substr(1, key.size() - 2);
-    return map_.find(std::hash<std::string_view>{}(substring));
+    auto range     = map_.equal_range(std::hash<std::string_view>{}(substring));
+
+    // Different keys may share the same hash, check the actual key
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        if (iter->second.key == substring)
+            return iter;
+    }
+
+    return map_.end();
+}
+
+localizer::format_template localizer::compile_template_(std::string message) {
+    format_template tmpl;
+    tmpl.text.reserve(message.size());
+
+    std::size_t literal_start  = 0;
+    std::size_t auto_index     = 0;
+    bool        has_auto_index = false;
+    bool        has_index      = false;
+
+    const auto fail = [&]() {
+        // Unsupported or invalid format string; will be handled by fmtlib directly
+        format_template result;
+        result.source = std::move(message);
+        return result;
+    };
+
+    std::size_t pos = 0;
+    while (pos < message.size()) {
+        const char c = message[pos];
+        if (c == '}') {
+            if (pos + 1 == message.size() || message[pos + 1] != '}')
+                return fail();
+
+            tmpl.text += '}';
+            pos += 2;
+            continue;
+        }
+
+        if (c != '{') {
+            tmpl.text += c;
+            ++pos;
+            continue;
+        }
+
+        if (pos + 1 < message.size() && message[pos + 1] == '{') {
+            tmpl.text += '{';
+            pos += 2;
+            continue;
+        }
+
+        const std::size_t end = message.find('}', pos + 1);
+        if (end == std::string::npos)
+            return fail();
+
+        const std::string_view field = std::string_view(message).substr(pos + 1, end - pos - 1);
+        if (field.find('{') != std::string_view::npos) {
+            // Dynamic width or precision
+            return fail();
+        }
+
+        const std::size_t      colon = field.find(':');
+        const std::string_view id    = field.substr(0, colon);
+
+        format_template::op op;
+        if (id.empty()) {
+            has_auto_index = true;
+            op.arg_index   = auto_index++;
+        } else {
+            if (id.find_first_not_of("0123456789") != std::string_view::npos) {
+                // Named argument
+                return fail();
+            }
+
+            if (id.size() > 9u) {
+                // Let fmtlib report the error
+                return fail();
+            }
+
+            has_index    = true;
+            op.arg_index = std::stoul(std::string(id));
+        }
+
+        if (colon != std::string_view::npos && colon + 1 < field.size())
+            op.format = "{:" + std::string(field.substr(colon + 1)) + "}";
+
+        op.literal_offset = literal_start;
+        op.literal_size   = tmpl.text.size() - literal_start;
+        literal_start     = tmpl.text.size();
+
+        tmpl.arg_count = std::max(tmpl.arg_count, op.arg_index + 1);
+        tmpl.ops.push_back(std::move(op));
+
+        pos = end + 1;
+    }
+
+    if (has_auto_index && has_index) {
+        // Cannot mix automatic and manual indexing
+        return fail();
+    }
+
+    if (literal_start != tmpl.text.size()) {
+        format_template::op op;
+        op.literal_offset = literal_start;
+        op.literal_size   = tmpl.text.size() - literal_start;
+        tmpl.ops.push_back(std::move(op));
+    }
+
+    tmpl.source      = std::move(message);
+    tmpl.is_compiled = true;
+    return tmpl;
+}
+
+std::string localizer::apply_template_variants_(
+    const format_template& tmpl, const std::vector<utils::variant>& args) const {
+    if (tmpl.arg_count == 0)
+        return tmpl.text;
+
+    std::string output;
+    output.reserve(tmpl.text.size());
+    for (const auto& op : tmpl.ops) {
+        output.append(tmpl.text, op.literal_offset, op.literal_size);
+        if (op.arg_index == format_template::no_arg)
+            continue;
+
+        std::visit(
+            [&](const auto& value) {
+                using inner_type = std::decay_t<decltype(value)>;
+                if constexpr (std::is_same_v<inner_type, utils::empty>)
+                    append_argument_(output, op.format, static_cast<const char*>(""));
+                else
+                    append_argument_(output, op.format, value);
+            },
+            args[op.arg_index]);
+    }
+
+    return output;
 }
 
 std::string localizer::format_string(std::string_view message, sol::variadic_args args) const {
     fmt::dynamic_format_arg_store<fmt::format_context> store;
     for (auto&& arg : args) {
-        lxgui::utils::variant variant;
-        if (!arg.is<sol::lua_nil_t>())
-            variant = arg;
-
+        const utils::variant variant = to_variant(arg);
         std::visit(
-            [&](auto& value) {
+            [&](const auto& value) {
                 using inner_type = std::decay_t<decltype(value)>;
                 if constexpr (std::is_same_v<inner_type, lxgui::utils::empty>)
                     store.push_back(static_cast<const char*>(""));
@@ -811,8 +1019,30 @@ std::string localizer::localize(std::string_view key, sol::variadic_args args) c
     return std::visit(
         [&](const auto& item) {
             using inner_type = std::decay_t<decltype(item)>;
-            if constexpr (std::is_same_v<inner_type, std::string>) {
-                return format_string(item, args);
+            if constexpr (std::is_same_v<inner_type, format_template>) {
+                if (!item.is_compiled || item.arg_count > args.size())
+                    return format_string(item.source, args);
+
+                // Same output as fmtlib: the text has its escaped braces resolved
+                if (item.arg_count == 0)
+                    return item.text;
+
+                std::vector<utils::variant> arg_list;
+                arg_list.reserve(args.size());
+                for (auto&& arg : args)
+                    arg_list.push_back(to_variant(arg));
+
+                if (cache_.empty())
+                    return apply_template_variants_(item, arg_list);
+
+                auto& entry = cache_[hash_arguments(&item, arg_list) % cache_.size()];
+                if (entry.tmpl == &item && are_arguments_equal(entry.args, arg_list))
+                    return entry.result;
+
+                entry.tmpl   = &item;
+                entry.result = apply_template_variants_(item, arg_list);
+                entry.args   = std::move(arg_list);
+                return entry.result;
             } else {
                 auto result = item(args);
                 if (!result.valid()) {
@@ -831,7 +1061,7 @@ std::string localizer::localize(std::string_view key, sol::variadic_args args) c
                 return std::string{key};
             }
         },
-        iter->second);
+        iter->second.item);
 }
 
 } // namespace lxgui::gui
@@ -167,6 +167,17 @@ void manager::close_ui() {
 }
 
 void manager::close_ui_now() {
+    close_ui_(false);
+
+    // All frames are destroyed, give the memory back to the system
+    if (!memory_arena_.release()) {
+        gui::out << gui::warning
+                 << "gui::manager: some UI objects are still alive after closing the UI."
+                 << std::endl;
+    }
+}
+
+void manager::close_ui_(bool keep_lua) {
     if (!is_loaded_)
         return;
 
@@ -176,7 +187,11 @@ void manager::close_ui_now() {
     virtual_root_   = nullptr;
     root_           = nullptr;
     addon_registry_ = nullptr;
-    lua_            = nullptr;
+
+    if (!keep_lua || !has_lua_snapshot_) {
+        lua_              = nullptr;
+        has_lua_snapshot_ = false;
+    }
 
     localizer_->clear_translations();
 
@@ -184,6 +199,7 @@ void manager::close_ui_now() {
     is_first_iteration_ = true;
     close_ui_flag_      = false;
     reload_ui_flag_     = false;
+    reload_addon_list_.clear();
 }
 
 void manager::reload_ui() {
@@ -191,15 +207,53 @@ void manager::reload_ui() {
 }
 
 void manager::reload_ui_now() {
+    const bool fast_reload = fast_reload_enabled_ && is_loaded_;
+    if (fast_reload)
+        renderer_->retain_resources();
+
     gui::out << "Closing UI..." << std::endl;
-    close_ui_now();
+    close_ui_(fast_reload);
     gui::out << "Done. Loading UI..." << std::endl;
     load_ui();
+
+    if (fast_reload)
+        renderer_->release_retained_resources();
+
     // Call update again, otherwise we may call render() with no prior update() call.
     update_ui(0.0);
     gui::out << "Done." << std::endl;
 }
 
+void manager::set_fast_reload_enabled(bool enabled) {
+    fast_reload_enabled_ = enabled;
+}
+
+bool manager::is_fast_reload_enabled() const {
+    return fast_reload_enabled_;
+}
+
+void manager::reload_addon(const std::string& addon_name) {
+    if (utils::find(reload_addon_list_, addon_name) == reload_addon_list_.end())
+        reload_addon_list_.push_back(addon_name);
+}
+
+void manager::reload_addon_now(const std::string& addon_name) {
+    if (!is_loaded_ || !addon_registry_)
+        return;
+
+    if (fast_reload_enabled_)
+        renderer_->retain_resources();
+
+    gui::out << "Re-loading addon \"" << addon_name << "\"..." << std::endl;
+    if (addon_registry_->reload_addon(addon_name))
+        gui::out << "Done." << std::endl;
+
+    if (fast_reload_enabled_)
+        renderer_->release_retained_resources();
+
+    root_->notify_hovered_frame_dirty();
+}
+
 void manager::render_ui() const {
     renderer_->begin();
 
@@ -213,6 +267,9 @@ bool manager::is_loaded() const {
 }
 
 void manager::update_ui(float delta) {
+    // Forward buffered input events, if any
+    input_dispatcher_->process_events();
+
     DEBUG_LOG(" Update regions...");
     root_->update(delta);
 
@@ -228,6 +285,12 @@ void manager::update_ui(float delta) {
         close_ui_now();
     } else if (reload_ui_flag_) {
         reload_ui_now();
+    } else if (!reload_addon_list_.empty()) {
+        auto addon_list = std::move(reload_addon_list_);
+        reload_addon_list_.clear();
+
+        for (const auto& addon_name : addon_list)
+            reload_addon_now(addon_name);
     }
 }
 
@@ -13,6 +13,7 @@
 #include "lxgui/input_keys.hpp"
 
 #include <lxgui/extern_sol2_state.hpp>
+#include <vector>
 
 /** Global functions for interacting with the GUI.
  * The functions listed on this page are registered in the
@@ -26,9 +27,82 @@
 
 namespace lxgui::gui {
 
+namespace {
+const char* lua_snapshot_key = "_LXGUI_BASE_STATE";
+
+template<typename TableType>
+sol::table make_shallow_copy(sol::state& lua, const TableType& table) {
+    sol::table copy(lua.lua_state(), sol::create);
+    for (const auto& key_value : table)
+        copy.raw_set(key_value.first, key_value.second);
+
+    return copy;
+}
+
+template<typename TableType>
+void restore_shallow_copy(TableType& table, const sol::table& copy) {
+    std::vector<sol::object> removed_key_list;
+    for (const auto& key_value : table) {
+        if (copy.raw_get<sol::object>(key_value.first) == sol::lua_nil)
+            removed_key_list.push_back(key_value.first);
+    }
+
+    for (const auto& key : removed_key_list)
+        table.raw_set(key, sol::lua_nil);
+
+    for (const auto& key_value : copy)
+        table.raw_set(key_value.first, key_value.second);
+}
+} // namespace
+
+void manager::take_lua_snapshot_() {
+    auto& lua = *lua_;
+
+    sol::table snapshot(lua.lua_state(), sol::create);
+    sol::table globals_copy = make_shallow_copy(lua, lua.globals());
+    sol::table tables_copy(lua.lua_state(), sol::create);
+
+    // Also save the content of global tables (libraries, types, etc.),
+    // since addons are free to modify them.
+    for (const auto& key_value : globals_copy) {
+        if (key_value.second.get_type() != sol::type::table)
+            continue;
+
+        sol::table table = key_value.second.as<sol::table>();
+        tables_copy.raw_set(table, make_shallow_copy(lua, table));
+    }
+
+    snapshot["globals"] = globals_copy;
+    snapshot["tables"]  = tables_copy;
+
+    lua.registry()[lua_snapshot_key] = snapshot;
+    has_lua_snapshot_                = true;
+}
+
+void manager::restore_lua_snapshot_() {
+    auto& lua = *lua_;
+
+    sol::table snapshot     = lua.registry()[lua_snapshot_key];
+    sol::table globals_copy = snapshot["globals"];
+    sol::table tables_copy  = snapshot["tables"];
+
+    auto globals = lua.globals();
+    restore_shallow_copy(globals, globals_copy);
+
+    for (const auto& key_value : tables_copy) {
+        sol::table table = key_value.first.as<sol::table>();
+        restore_shallow_copy(table, key_value.second.as<sol::table>());
+    }
+
+    // Release everything that was only referenced by the previous UI
+    lua.collect_garbage();
+}
+
 void manager::create_lua_() {
-    if (lua_)
+    if (lua_) {
+        restore_lua_snapshot_();
         return;
+    }
 
     lua_ = std::unique_ptr<sol::state>(new sol::state());
     lua_->open_libraries(
@@ -99,6 +173,16 @@ void manager::create_lua_() {
      */
     lua.set_function("reload_ui", [&]() { reload_ui(); });
 
+    /** Closes a single addon and re-loads it from files.
+     * All the frames created by this addon are destroyed, then the addon's files are loaded
+     * again. The rest of the GUI is left untouched. For safety reasons, the re-loading
+     * operation will not be triggered instantaneously. The addon will be reloaded at the end
+     * of the current update tick, when it is safe to do so.
+     * @function reload_addon
+     * @tparam string name The name of the addon to re-load (name of its directory)
+     */
+    lua.set_function("reload_addon", [&](const std::string& name) { reload_addon(name); });
+
     /** Sets the global interface scaling factor.
      * @function set_interface_scaling_factor
      * @tparam number factor The scaling factor (1: no scaling, 2: twice larger fonts and
@@ -124,6 +208,9 @@ void manager::create_lua_() {
 
     // Register user callbacks
     on_create_lua(lua);
+
+    if (fast_reload_enabled_)
+        take_lua_snapshot_();
 }
 
 } // namespace lxgui::gui
@@ -159,20 +159,64 @@ float region::get_alpha() const {
 }
 
 float region::get_effective_alpha() const {
-    if (parent_) {
-        return parent_->get_effective_alpha() * get_alpha();
-    } else {
-        return get_alpha();
-    }
+    return effective_alpha_;
 }
 
 void region::set_alpha(float alpha) {
     if (alpha_ != alpha) {
         alpha_ = alpha;
-        notify_renderer_need_redraw();
+        update_effective_alpha_();
     }
 }
 
+void region::update_effective_alpha_() {
+    const float alpha           = alpha_ * animation_alpha_;
+    const float effective_alpha = parent_ ? parent_->effective_alpha_ * alpha : alpha;
+    if (effective_alpha_ == effective_alpha)
+        return;
+
+    effective_alpha_ = effective_alpha;
+    notify_effective_alpha_changed_();
+}
+
+void region::set_animation_alpha_(const animation_group& group, float alpha) {
+    auto iter = utils::find_if(
+        animation_alpha_list_, [&](const auto& factor) { return factor.first == &group; });
+
+    if (iter != animation_alpha_list_.end())
+        iter->second = alpha;
+    else
+        animation_alpha_list_.emplace_back(&group, alpha);
+
+    update_animation_alpha_();
+}
+
+void region::reset_animation_alpha_(const animation_group& group) {
+    auto iter = utils::find_if(
+        animation_alpha_list_, [&](const auto& factor) { return factor.first == &group; });
+
+    if (iter == animation_alpha_list_.end())
+        return;
+
+    animation_alpha_list_.erase(iter);
+    update_animation_alpha_();
+}
+
+void region::update_animation_alpha_() {
+    float animation_alpha = 1.0f;
+    for (const auto& factor : animation_alpha_list_)
+        animation_alpha *= factor.second;
+
+    if (animation_alpha_ != animation_alpha) {
+        animation_alpha_ = animation_alpha;
+        update_effective_alpha_();
+    }
+}
+
+void region::notify_effective_alpha_changed_() {
+    notify_renderer_need_redraw();
+}
+
 void region::show() {
     if (is_shown_)
         return;
@@ -274,6 +318,7 @@ const vector2f& region::get_dimensions() const {
 }
 
 vector2f region::get_apparent_dimensions() const {
+    resolve_pending_layout_();
     return vector2f(borders_.width(), borders_.height());
 }
 
@@ -286,9 +331,15 @@ bool region::is_apparent_height_defined() const {
 }
 
 bool region::is_in_region(const vector2f& position) const {
+    const vector2f local_position = to_local_position(position);
+
     return (
-        (borders_.left <= position.x && position.x <= borders_.right - 1) &&
-        (borders_.top <= position.y && position.y <= borders_.bottom - 1));
+        (borders_.left <= local_position.x && local_position.x <= borders_.right - 1) &&
+        (borders_.top <= local_position.y && local_position.y <= borders_.bottom - 1));
+}
+
+vector2f region::to_local_position(const vector2f& position) const {
+    return position - get_effective_frame_renderer()->get_render_offset();
 }
 
 void region::set_name_(const std::string& name) {
@@ -321,6 +372,8 @@ void region::set_parent_(utils::observer_ptr<frame> parent) {
 
     parent_ = std::move(parent);
 
+    update_effective_alpha_();
+
     if (!is_virtual()) {
         notify_borders_need_update();
     }
@@ -339,26 +392,44 @@ void region::destroy() {
 }
 
 vector2f region::get_center() const {
+    resolve_pending_layout_();
     return borders_.center();
 }
 
 float region::get_left() const {
+    resolve_pending_layout_();
     return borders_.left;
 }
 
 float region::get_right() const {
+    resolve_pending_layout_();
     return borders_.right;
 }
 
 float region::get_top() const {
+    resolve_pending_layout_();
     return borders_.top;
 }
 
 float region::get_bottom() const {
+    resolve_pending_layout_();
     return borders_.bottom;
 }
 
 const bounds2f& region::get_borders() const {
+    resolve_pending_layout_();
+    return borders_;
+}
+
+void region::resolve_pending_layout_() const {
+    // Inside a layout batch, the borders of this region (or of the regions it is anchored to)
+    // may be queued for update: resolve them before they are read
+    auto& root = manager_.get_root();
+    if (root.has_pending_layout())
+        root.resolve_layout();
+}
+
+bounds2f region::get_render_bounds() const {
     return borders_;
 }
 
@@ -379,6 +450,9 @@ void region::clear_all_anchors() {
 
     defined_borders_ = bounds2<bool>(false, false, false, false);
 
+    if (had_anchors)
+        notify_anchors_changed_();
+
     if (had_anchors || !is_virtual_) {
         notify_borders_need_update();
         notify_renderer_need_redraw();
@@ -429,6 +503,7 @@ void region::set_all_anchors(const std::string& obj_name) {
             parent->add_anchored_object(*this);
         }
 
+        notify_anchors_changed_();
         notify_borders_need_update();
         notify_renderer_need_redraw();
     }
@@ -495,6 +570,7 @@ void region::set_anchor(const anchor_data& a) {
     }
 
     if (!is_virtual_) {
+        notify_anchors_changed_();
         notify_borders_need_update();
         notify_renderer_need_redraw();
     }
@@ -533,6 +609,8 @@ anchor& region::modify_anchor(point p) {
             "region", "Cannot modify a point that does not exist. Use set_anchor() first.");
     }
 
+    notify_anchors_changed_();
+
     return *a;
 }
 
@@ -550,6 +628,11 @@ const std::array<std::optional<anchor>, 9>& region::get_anchors() const {
     return anchor_list_;
 }
 
+void region::notify_anchors_changed_() {
+    if (!is_virtual_)
+        get_manager().get_root().notify_anchors_changed();
+}
+
 bool region::is_virtual() const {
     return is_virtual_;
 }
@@ -612,7 +695,13 @@ bool region::make_borders_(float& min, float& max, float center, float size) con
 }
 
 void region::read_anchors_(
-    float& left, float& right, float& top, float& bottom, float& x_center, float& y_center) const {
+    float&          left,
+    float&          right,
+    float&          top,
+    float&          bottom,
+    float&          x_center,
+    float&          y_center,
+    const vector2f& target_dimensions) const {
     left   = +std::numeric_limits<float>::infinity();
     right  = -std::numeric_limits<float>::infinity();
     top    = +std::numeric_limits<float>::infinity();
@@ -623,7 +712,7 @@ void region::read_anchors_(
             continue;
 
         const anchor&  a = opt_anchor.value();
-        const vector2f p = a.get_point(*this);
+        const vector2f p = a.get_point(*this, target_dimensions);
 
         switch (a.object_point) {
         case point::top_left:
@@ -666,15 +755,12 @@ void region::read_anchors_(
     }
 }
 
-void region::update_borders_() {
+void region::compute_borders_(const vector2f& target_dimensions) {
 // #define DEBUG_LOG(msg) gui::out << (msg) << std::endl
 #define DEBUG_LOG(msg)
 
     DEBUG_LOG("  Update anchors for " + lua_name_);
 
-    const bool old_is_ready    = is_valid_;
-    const auto old_border_list = borders_;
-
     is_valid_ = true;
 
     if (!anchor_list_.empty()) {
@@ -687,7 +773,7 @@ void region::update_borders_() {
             round_to_pixel(dimensions_.y, utils::rounding_method::nearest_not_zero);
 
         DEBUG_LOG("  Read anchors");
-        read_anchors_(left, right, top, bottom, x_center, y_center);
+        read_anchors_(left, right, top, bottom, x_center, y_center, target_dimensions);
         DEBUG_LOG("    left=" + utils::to_string(left));
         DEBUG_LOG("    right=" + utils::to_string(right));
         DEBUG_LOG("    top=" + utils::to_string(top));
@@ -732,19 +818,38 @@ void region::update_borders_() {
     DEBUG_LOG("    top=" + utils::to_string(borders_.top));
     DEBUG_LOG("    bottom=" + utils::to_string(borders_.bottom));
 
-    if (borders_ != old_border_list || is_valid_ != old_is_ready) {
-        DEBUG_LOG("  Fire redraw");
-        notify_renderer_need_redraw();
-    }
-
     DEBUG_LOG("  @");
 #undef DEBUG_LOG
 }
 
+void region::update_borders_() {
+    const bool old_valid       = is_valid_;
+    const auto old_border_list = borders_;
+
+    compute_borders_(get_effective_frame_renderer()->get_target_dimensions());
+    notify_borders_updated_(old_border_list, old_valid);
+}
+
+void region::notify_borders_updated_(const bounds2f& old_border_list, bool old_valid) {
+    if (borders_ != old_border_list || is_valid_ != old_valid)
+        notify_renderer_need_redraw();
+}
+
+bool region::can_compute_borders_in_parallel_() const {
+    return true;
+}
+
 void region::notify_borders_need_update() {
     if (is_virtual())
         return;
 
+    auto& root = get_manager().get_root();
+    if (root.is_layout_deferred()) {
+        // Borders will be updated by the root, once per region and in dependency order
+        root.queue_borders_update(*this);
+        return;
+    }
+
     const bool old_valid       = is_valid_;
     const auto old_border_list = borders_;
 
@@ -1,18 +1,27 @@
 #include "lxgui/gui_renderer.hpp"
 
 #include "lxgui/gui_atlas.hpp"
+#include "lxgui/gui_exception.hpp"
+#include "lxgui/gui_font.hpp"
 #include "lxgui/gui_out.hpp"
 #include "lxgui/gui_quad.hpp"
 #include "lxgui/gui_render_target.hpp"
+#include "lxgui/gui_texture_file.hpp"
+#include "lxgui/utils_file_system.hpp"
+#include "lxgui/utils_std.hpp"
 #include "lxgui/utils_string.hpp"
 
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+
 namespace lxgui::gui {
 
 void renderer::begin(std::shared_ptr<render_target> target) {
     if (is_quad_batching_enabled()) {
         current_material_ = nullptr;
 
-        if (is_vertex_cache_enabled()) {
+        if (is_vertex_cache_enabled() && !is_quad_streaming_enabled()) {
             try {
                 if (quad_cache_[0].cache == nullptr) {
                     for (std::size_t index = 0u; index < batching_cache_cycle_size; ++index) {
@@ -39,14 +48,26 @@ void renderer::end() {
         flush_quad_batch();
     }
 
+    if (!clip_rect_stack_.empty()) {
+        gui::out << gui::warning << "gui::renderer: Missing call to pop_clip_rect()." << std::endl;
+
+        clip_rect_stack_.clear();
+        if (is_scissor_supported())
+            set_scissor_(nullptr);
+    }
+
     end_();
 }
 
 void renderer::reset_counters() {
-    last_frame_batch_count_  = batch_count_;
-    last_frame_vertex_count_ = vertex_count_;
-    batch_count_             = 0;
-    vertex_count_            = 0;
+    last_frame_batch_count_         = batch_count_;
+    last_frame_vertex_count_        = vertex_count_;
+    last_frame_culled_frame_count_  = culled_frame_count_;
+    last_frame_culled_region_count_ = culled_region_count_;
+    batch_count_                    = 0;
+    vertex_count_                   = 0;
+    culled_frame_count_             = 0;
+    culled_region_count_            = 0;
 }
 
 std::size_t renderer::get_batch_count() const {
@@ -57,6 +78,22 @@ std::size_t renderer::get_vertex_count() const {
     return last_frame_vertex_count_;
 }
 
+std::size_t renderer::get_culled_frame_count() const {
+    return last_frame_culled_frame_count_;
+}
+
+std::size_t renderer::get_culled_region_count() const {
+    return last_frame_culled_region_count_;
+}
+
+void renderer::notify_frame_culled() {
+    ++culled_frame_count_;
+}
+
+void renderer::notify_region_culled() {
+    ++culled_region_count_;
+}
+
 void renderer::set_view(const matrix4f& view_matrix) {
     if (is_quad_batching_enabled()) {
         flush_quad_batch();
@@ -65,6 +102,69 @@ void renderer::set_view(const matrix4f& view_matrix) {
     set_view_(view_matrix);
 }
 
+bool renderer::is_scissor_supported() const {
+    return false;
+}
+
+void renderer::set_scissor_(const bounds2f*) {}
+
+void renderer::push_clip_rect(const bounds2f& rect) {
+    if (is_quad_batching_enabled()) {
+        flush_quad_batch();
+    }
+
+    // Convert to screen-space, where the rectangle no longer depends on the view
+    const matrix4f view = get_view();
+
+    const std::array<vector2f, 4> corners = {
+        rect.top_left() * view, vector2f(rect.right, rect.top) * view,
+        rect.bottom_right() * view, vector2f(rect.left, rect.bottom) * view};
+
+    bounds2f screen_rect(corners[0].x, corners[0].x, corners[0].y, corners[0].y);
+    for (const auto& corner : corners) {
+        screen_rect.left   = std::min(screen_rect.left, corner.x);
+        screen_rect.right  = std::max(screen_rect.right, corner.x);
+        screen_rect.top    = std::min(screen_rect.top, corner.y);
+        screen_rect.bottom = std::max(screen_rect.bottom, corner.y);
+    }
+
+    if (!clip_rect_stack_.empty()) {
+        // Only keep the intersection with the current rectangle
+        const bounds2f& parent_rect = clip_rect_stack_.back();
+
+        screen_rect.left   = std::max(screen_rect.left, parent_rect.left);
+        screen_rect.right  = std::min(screen_rect.right, parent_rect.right);
+        screen_rect.top    = std::max(screen_rect.top, parent_rect.top);
+        screen_rect.bottom = std::min(screen_rect.bottom, parent_rect.bottom);
+
+        // The intersection may be empty
+        screen_rect.right  = std::max(screen_rect.right, screen_rect.left);
+        screen_rect.bottom = std::max(screen_rect.bottom, screen_rect.top);
+    }
+
+    clip_rect_stack_.push_back(screen_rect);
+
+    if (is_scissor_supported())
+        set_scissor_(&clip_rect_stack_.back());
+}
+
+void renderer::pop_clip_rect() {
+    if (clip_rect_stack_.empty()) {
+        gui::out << gui::warning << "gui::renderer: Mismatched call to pop_clip_rect()."
+                 << std::endl;
+        return;
+    }
+
+    if (is_quad_batching_enabled()) {
+        flush_quad_batch();
+    }
+
+    clip_rect_stack_.pop_back();
+
+    if (is_scissor_supported())
+        set_scissor_(clip_rect_stack_.empty() ? nullptr : &clip_rect_stack_.back());
+}
+
 void renderer::render_quad(const quad& q) {
     render_quads(q.mat.get(), {q.v});
 }
@@ -88,17 +188,50 @@ bool renderer::uses_same_texture_(const material* mat1, const material* mat2) co
 
 void renderer::render_quads(
     const material* mat, const std::vector<std::array<vertex, 4>>& quad_list) {
+    add_quads_(mat, quad_list, nullptr);
+}
+
+void renderer::render_tiled_quads(
+    const material*                           mat,
+    const std::vector<std::array<vertex, 4>>& quad_list,
+    const std::vector<bounds2f>&              tile_rect_list) {
+    if (!is_quad_tiling_supported()) {
+        throw gui::exception("gui::renderer", "Quad tiling is not supported by this renderer.");
+    }
+
+    if (tile_rect_list.size() != quad_list.size()) {
+        throw gui::exception(
+            "gui::renderer", "There must be one tiling region per quad (got " +
+                                 utils::to_string(tile_rect_list.size()) + " for " +
+                                 utils::to_string(quad_list.size()) + " quads).");
+    }
+
+    add_quads_(mat, quad_list, &tile_rect_list);
+}
+
+void renderer::add_quads_(
+    const material*                           mat,
+    const std::vector<std::array<vertex, 4>>& quad_list,
+    const std::vector<bounds2f>*              tile_rect_list) {
     if (quad_list.empty())
         return;
 
     if (!is_quad_batching_enabled()) {
         // Render immediately
         vertex_count_ += quad_list.size() * 6;
-        render_quads_(mat, quad_list);
+        if (tile_rect_list)
+            render_tiled_quads_(mat, quad_list, *tile_rect_list);
+        else
+            render_quads_(mat, quad_list);
         ++batch_count_;
         return;
     }
 
+    if (is_multi_texture_batching_enabled()) {
+        add_to_multi_texture_batch_(mat, quad_list, tile_rect_list);
+        return;
+    }
+
     if (!uses_same_texture_(mat, current_material_)) {
         // Render current batch and start a new one
         flush_quad_batch();
@@ -116,7 +249,8 @@ void renderer::render_quads(
     }
 
     // Add to the cache
-    auto& cache = quad_cache_[current_quad_cache_];
+    auto&             cache      = quad_cache_[current_quad_cache_];
+    const std::size_t first_quad = cache.data.size();
 
     if (!mat && is_texture_atlas_enabled() && is_texture_vertex_color_supported()) {
         // To allow quads with no texture to enter the batch
@@ -131,6 +265,101 @@ void renderer::render_quads(
     } else {
         cache.data.insert(cache.data.end(), quad_list.begin(), quad_list.end());
     }
+
+    add_tile_rects_(cache, first_quad, tile_rect_list);
+}
+
+void renderer::add_tile_rects_(
+    quad_batcher& cache, std::size_t first_quad, const std::vector<bounds2f>* tile_rect_list) {
+    if (tile_rect_list) {
+        // Quads added before had no tiling region
+        cache.tile_rect_list.resize(first_quad);
+        cache.tile_rect_list.insert(
+            cache.tile_rect_list.end(), tile_rect_list->begin(), tile_rect_list->end());
+    } else if (!cache.tile_rect_list.empty()) {
+        cache.tile_rect_list.resize(cache.data.size());
+    }
+}
+
+void renderer::add_to_multi_texture_batch_(
+    const material*                           mat,
+    const std::vector<std::array<vertex, 4>>& quad_list,
+    const std::vector<bounds2f>*              tile_rect_list) {
+    auto* cache = &quad_cache_[current_quad_cache_];
+    if (cache->material_list.empty() && !cache->data.empty()) {
+        // Batch started before enabling multi-texture batching
+        flush_quad_batch();
+        cache = &quad_cache_[current_quad_cache_];
+    }
+
+    // Look for a slot in the current batch that can render this material
+    const bool white_pixel_in_atlas =
+        is_texture_atlas_enabled() && is_texture_vertex_color_supported();
+
+    auto iter = utils::find_if(cache->material_list, [&](const material* other) {
+        if (other == mat || (mat && other && mat->uses_same_texture(*other)))
+            return true;
+
+        // Quads with no texture can use the top-left pixel of an atlas page
+        return !mat && white_pixel_in_atlas && other && other->is_in_atlas();
+    });
+
+    if (iter == cache->material_list.end()) {
+        if (cache->material_list.size() == get_batch_texture_slot_count()) {
+            // No slot left, render current batch and start a new one
+            flush_quad_batch();
+            cache = &quad_cache_[current_quad_cache_];
+        }
+
+        cache->material_list.push_back(mat);
+        iter = cache->material_list.end() - 1;
+    }
+
+    const std::size_t slot       = iter - cache->material_list.begin();
+    const bool        use_atlas  = !mat && *iter != nullptr;
+    const std::size_t first_quad = cache->data.size();
+
+    cache->data.reserve(cache->data.size() + quad_list.size());
+    for (const auto& orig_quad : quad_list) {
+        cache->data.push_back(orig_quad);
+        if (use_atlas) {
+            auto& quad  = cache->data.back();
+            quad[0].uvs = quad[1].uvs = quad[2].uvs = quad[3].uvs = vector2f(0.0f, 0.0f);
+        }
+    }
+
+    cache->slot_list.insert(cache->slot_list.end(), quad_list.size(), slot);
+    add_tile_rects_(*cache, first_quad, tile_rect_list);
+}
+
+void renderer::render_quads_multi_texture_(
+    const std::vector<const material*>&       material_list,
+    const std::vector<std::array<vertex, 4>>& quad_list,
+    const std::vector<std::size_t>&           slot_list,
+    const std::vector<bounds2f>&              tile_rect_list) {
+    std::vector<std::array<vertex, 4>> run;
+    std::vector<bounds2f>              tile_run;
+
+    std::size_t start = 0u;
+    while (start < quad_list.size()) {
+        std::size_t end = start + 1u;
+        while (end < quad_list.size() && slot_list[end] == slot_list[start])
+            ++end;
+
+        run.assign(quad_list.begin() + start, quad_list.begin() + end);
+        if (!tile_rect_list.empty()) {
+            tile_run.assign(tile_rect_list.begin() + start, tile_rect_list.begin() + end);
+            render_tiled_quads_(material_list[slot_list[start]], run, tile_run);
+        } else {
+            render_quads_(material_list[slot_list[start]], run);
+        }
+
+        // Each run is a separate draw call; flush_quad_batch() only counts the first one
+        if (start != 0u)
+            ++batch_count_;
+
+        start = end;
+    }
 }
 
 void renderer::flush_quad_batch() {
@@ -140,7 +369,17 @@ void renderer::flush_quad_batch() {
 
     vertex_count_ += cache.data.size() * 6;
 
-    if (cache.cache) {
+    if (cache.material_list.size() == 1u) {
+        // Multi-texture batch with a single texture, render as a regular batch
+        current_material_ = cache.material_list[0];
+    }
+
+    if (cache.material_list.size() > 1u) {
+        render_quads_multi_texture_(
+            cache.material_list, cache.data, cache.slot_list, cache.tile_rect_list);
+    } else if (!cache.tile_rect_list.empty()) {
+        render_tiled_quads_(current_material_, cache.data, cache.tile_rect_list);
+    } else if (cache.cache && !is_quad_streaming_enabled()) {
         cache.cache->update(cache.data[0].data(), cache.data.size() * 4);
         render_cache_(current_material_, *cache.cache, matrix4f::identity);
     } else {
@@ -148,6 +387,9 @@ void renderer::flush_quad_batch() {
     }
 
     cache.data.clear();
+    cache.material_list.clear();
+    cache.slot_list.clear();
+    cache.tile_rect_list.clear();
     current_material_ = nullptr;
 
     ++current_quad_cache_;
@@ -178,6 +420,27 @@ void renderer::set_quad_batching_enabled(bool enabled) {
     quad_batching_enabled_ = enabled;
 }
 
+std::size_t renderer::get_batch_texture_slot_count() const {
+    return 1u;
+}
+
+bool renderer::is_quad_tiling_supported() const {
+    return false;
+}
+
+void renderer::render_tiled_quads_(
+    const material*, const std::vector<std::array<vertex, 4>>&, const std::vector<bounds2f>&) {
+    throw gui::exception("gui::renderer", "Quad tiling is not supported by this renderer.");
+}
+
+bool renderer::is_multi_texture_batching_enabled() const {
+    return multi_texture_enabled_ && quad_batching_enabled_ && get_batch_texture_slot_count() > 1u;
+}
+
+void renderer::set_multi_texture_batching_enabled(bool enabled) {
+    multi_texture_enabled_ = enabled;
+}
+
 std::shared_ptr<gui::material>
 renderer::create_material(const std::string& file_name, material::filter filt) {
     std::string backed_name = utils::to_string(static_cast<std::size_t>(filt)) + '|' + file_name;
@@ -190,8 +453,11 @@ renderer::create_material(const std::string& file_name, material::filter filt) {
     }
 
     try {
-        std::shared_ptr<gui::material> tex = create_material_(file_name, filt);
-        texture_list_[file_name]           = tex;
+        std::shared_ptr<gui::material> tex = create_material_raw_file_(file_name, filt);
+        if (!tex)
+            tex = create_material_(file_name, filt);
+
+        texture_list_[backed_name] = tex;
         return tex;
     } catch (const std::exception& e) {
         gui::out << gui::warning << e.what() << std::endl;
@@ -199,6 +465,59 @@ renderer::create_material(const std::string& file_name, material::filter filt) {
     }
 }
 
+bool renderer::is_texture_file_supported() const {
+    return false;
+}
+
+std::shared_ptr<gui::material>
+renderer::create_material_texture_file_(const texture_file&, material::filter) {
+    throw gui::exception("gui::renderer", "Raw texture files are not supported.");
+}
+
+std::shared_ptr<gui::material>
+renderer::create_material_raw_file_(const std::string& file_name, material::filter filt) {
+    if (!is_texture_file_supported())
+        return nullptr;
+
+    auto load_file = [&](const std::string& name) {
+        const texture_file file(name);
+        const std::size_t  max_size = get_texture_max_size();
+        if (file.get_dimensions().x > max_size || file.get_dimensions().y > max_size) {
+            throw gui::exception(
+                "gui::renderer", "'" + name + "' is larger than the maximum texture size (" +
+                                     utils::to_string(max_size) + ").");
+        }
+
+        return create_material_texture_file_(file, filt);
+    };
+
+    const std::string raw_file_name = texture_file::get_file_name(file_name);
+    if (raw_file_name == file_name)
+        return load_file(file_name);
+
+    if (!utils::file_exists(raw_file_name))
+        return nullptr;
+
+    // Only use the raw file if it was generated after the last change to the original file
+    std::error_code ec;
+    const auto      raw_time = std::filesystem::last_write_time(raw_file_name, ec);
+    if (ec)
+        return nullptr;
+
+    const auto time = std::filesystem::last_write_time(file_name, ec);
+    if (!ec && raw_time < time)
+        return nullptr;
+
+    try {
+        return load_file(raw_file_name);
+    } catch (const std::exception& e) {
+        gui::out << gui::warning << e.what() << std::endl;
+        gui::out << gui::warning << "gui::renderer: Falling back to '" << file_name << "'."
+                 << std::endl;
+        return nullptr;
+    }
+}
+
 namespace {
 std::string hash_font_parameters(
     const std::string&                   font_file,
@@ -280,6 +599,10 @@ void renderer::set_vertex_cache_enabled(bool enabled) {
     vertex_cache_enabled_ = enabled;
 }
 
+bool renderer::is_quad_streaming_enabled() const {
+    return false;
+}
+
 void renderer::auto_detect_settings() {
     vertex_cache_enabled_  = true;
     texture_atlas_enabled_ = true;
@@ -326,6 +649,14 @@ std::shared_ptr<material> renderer::create_atlas_material(
         return tex;
 }
 
+bool renderer::load_baked_atlas(
+    const std::string& atlas_category, const std::string& manifest_file, material::filter filt) {
+    if (!is_texture_atlas_enabled())
+        return false;
+
+    return get_atlas_(atlas_category, filt).load_baked_pages(manifest_file);
+}
+
 std::shared_ptr<font> renderer::create_atlas_font(
     const std::string&                   atlas_category,
     const std::string&                   font_file,
@@ -349,6 +680,9 @@ std::shared_ptr<font> renderer::create_atlas_font(
     if (!fnt)
         return nullptr;
 
+    if (!fnt->is_atlas_compatible())
+        return fnt;
+
     if (atlas.add_font(font_name, fnt))
         return fnt;
 
@@ -361,6 +695,58 @@ std::shared_ptr<material> renderer::create_material(std::shared_ptr<render_targe
     return create_material(std::move(target), rect);
 }
 
+void renderer::retain_resources() {
+    for (const auto& mat : texture_list_) {
+        if (std::shared_ptr<gui::material> lock = mat.second.lock())
+            retained_material_list_.push_back(std::move(lock));
+    }
+
+    for (const auto& fnt : font_list_) {
+        if (std::shared_ptr<gui::font> lock = fnt.second.lock())
+            retained_font_list_.push_back(std::move(lock));
+    }
+
+    for (const auto& atlas : atlas_list_)
+        atlas.second->collect_resources(retained_material_list_, retained_font_list_);
+}
+
+void renderer::release_retained_resources() {
+    retained_material_list_.clear();
+    retained_font_list_.clear();
+
+    prune_resources();
+}
+
+void renderer::prune_resources() {
+    for (auto iter = texture_list_.begin(); iter != texture_list_.end();) {
+        if (iter->second.expired())
+            iter = texture_list_.erase(iter);
+        else
+            ++iter;
+    }
+
+    for (auto iter = font_list_.begin(); iter != font_list_.end();) {
+        if (iter->second.expired())
+            iter = font_list_.erase(iter);
+        else
+            ++iter;
+    }
+
+    for (auto iter = atlas_list_.begin(); iter != atlas_list_.end();) {
+        iter->second->prune();
+        if (iter->second->get_page_count() == 0u)
+            iter = atlas_list_.erase(iter);
+        else
+            ++iter;
+    }
+
+    text_layout_cache_.prune();
+}
+
+text_layout_cache& renderer::get_text_layout_cache() {
+    return text_layout_cache_;
+}
+
 void renderer::notify_window_resized(const vector2ui&) {}
 
 } // namespace lxgui::gui
@@ -10,6 +10,10 @@
 #include "lxgui/input_world_dispatcher.hpp"
 #include "lxgui/utils_range.hpp"
 #include "lxgui/utils_std.hpp"
+#include "lxgui/utils_thread_pool.hpp"
+
+#include <algorithm>
+#include <unordered_map>
 
 // #define DEBUG_LOG(msg) gui::out << (msg) << std::endl
 #define DEBUG_LOG(msg)
@@ -124,12 +128,18 @@ void root::render() const {
     if (caching_enabled_) {
         renderer_.render_quad(screen_quad_);
     } else {
+        const bounds2f screen_bounds = get_screen_bounds_();
         for (const auto& s : strata_list_) {
-            render_strata_(s);
+            render_strata_(s, screen_bounds);
         }
     }
 }
 
+bounds2f root::get_screen_bounds_() const {
+    const vector2f dimensions = get_target_dimensions();
+    return bounds2f(0.0f, dimensions.x, 0.0f, dimensions.y);
+}
+
 void root::create_caching_render_target_() {
     try {
         if (target_)
@@ -187,9 +197,19 @@ void root::update(float delta) {
         obj.update(delta);
     }
 
+    // Update animations, after scripts had a chance to start or stop them
+    update_animations_(delta);
+
+    // Update borders that were changed during this frame
+    if (is_deferred_layout_enabled_)
+        resolve_layout();
+
     // Removed destroyed frames
     garbage_collect();
 
+    // Render cached frames, now that their content is up to date
+    update_render_caches_();
+
     bool redraw_flag = has_strata_list_changed_();
     reset_strata_list_changed_flag_();
 
@@ -214,7 +234,7 @@ void root::update(float delta) {
                         renderer_.set_view(matrix4f::view(view));
 
                         s.target->clear(color::empty);
-                        render_strata_(s);
+                        render_strata_(s, get_screen_bounds_());
 
                         renderer_.end();
                     }
@@ -273,10 +293,14 @@ bool root::is_caching_enabled() const {
 }
 
 void root::notify_scaling_factor_updated() {
+    begin_layout_batch();
+
     for (auto& obj : get_root_frames()) {
         obj.notify_scaling_factor_updated();
     }
 
+    end_layout_batch();
+
     if (target_)
         create_caching_render_target_();
 
@@ -297,9 +321,351 @@ void root::update_hovered_frame_() {
 }
 
 void root::notify_hovered_frame_dirty() {
+    if (is_resolving_layout_ || layout_batch_depth_ != 0u) {
+        // Borders are changing; update the hovered frame only once they are all updated
+        is_hovered_frame_dirty_ = true;
+        return;
+    }
+
     update_hovered_frame_();
 }
 
+void root::register_animated_frame(frame& obj) {
+    auto iter = utils::find_if(
+        animated_frame_list_, [&](const auto& animated) { return animated.get() == &obj; });
+
+    if (iter == animated_frame_list_.end())
+        animated_frame_list_.push_back(observer_from(&obj));
+}
+
+void root::update_animations_(float delta) {
+    // NB: frames registered during this loop will be updated next time
+    const std::size_t frame_count = animated_frame_list_.size();
+    for (std::size_t i = 0u; i < frame_count; ++i) {
+        // Copy, since the list can grow while updating
+        utils::observer_ptr<frame> obj = animated_frame_list_[i];
+        if (obj)
+            obj->update_animations(delta);
+    }
+
+    // Stop updating frames which were destroyed or have finished playing
+    auto iter_remove =
+        std::remove_if(animated_frame_list_.begin(), animated_frame_list_.end(), [](auto& obj) {
+            return obj == nullptr || !obj->is_animation_playing();
+        });
+
+    animated_frame_list_.erase(iter_remove, animated_frame_list_.end());
+}
+
+void root::register_render_cached_frame(frame& obj) {
+    auto iter = utils::find_if(
+        render_cached_frame_list_, [&](const auto& cached) { return cached.get() == &obj; });
+
+    if (iter == render_cached_frame_list_.end())
+        render_cached_frame_list_.push_back(observer_from(&obj));
+}
+
+void root::update_render_caches_() {
+    // Stop rendering frames which were destroyed or are no longer cached
+    auto iter_remove = std::remove_if(
+        render_cached_frame_list_.begin(), render_cached_frame_list_.end(),
+        [](auto& obj) { return obj == nullptr || !obj->is_render_cached(); });
+
+    render_cached_frame_list_.erase(iter_remove, render_cached_frame_list_.end());
+
+    if (render_cached_frame_list_.empty())
+        return;
+
+    // Frames cached in the bitmap of another cached frame must be rendered first
+    std::vector<std::pair<std::size_t, frame*>> sorted_list;
+    for (auto& obj : render_cached_frame_list_) {
+        std::size_t depth = 0u;
+        for (auto parent = obj->get_parent(); parent; parent = parent->get_parent())
+            ++depth;
+
+        sorted_list.emplace_back(depth, obj.get());
+    }
+
+    std::stable_sort(sorted_list.begin(), sorted_list.end(), [](const auto& p1, const auto& p2) {
+        return p1.first > p2.first;
+    });
+
+    for (auto& item : sorted_list)
+        item.second->update_render_cache();
+}
+
+void root::begin_layout_batch() {
+    ++layout_batch_depth_;
+}
+
+void root::end_layout_batch() {
+    if (layout_batch_depth_ == 0u) {
+        gui::out << gui::warning << "gui::root: "
+                 << "end_layout_batch() called without matching begin_layout_batch()." << std::endl;
+        return;
+    }
+
+    --layout_batch_depth_;
+    if (layout_batch_depth_ == 0u)
+        resolve_layout();
+}
+
+void root::set_deferred_layout_enabled(bool enabled) {
+    if (is_deferred_layout_enabled_ == enabled)
+        return;
+
+    is_deferred_layout_enabled_ = enabled;
+    if (!is_deferred_layout_enabled_)
+        resolve_layout();
+}
+
+bool root::is_deferred_layout_enabled() const {
+    return is_deferred_layout_enabled_;
+}
+
+bool root::is_layout_deferred() const {
+    return is_resolving_layout_ || is_deferred_layout_enabled_ || layout_batch_depth_ != 0u;
+}
+
+bool root::has_pending_layout() const {
+    // NB: check is_resolving_layout_ first; worker threads may call this while resolving
+    return !is_resolving_layout_ && !layout_queue_.empty();
+}
+
+void root::notify_anchors_changed() {
+    ++anchor_generation_;
+}
+
+void root::queue_borders_update(region& obj) {
+    if (obj.is_borders_update_queued_)
+        return;
+
+    obj.is_borders_update_queued_ = true;
+    layout_queue_.push_back(observer_from(&obj));
+}
+
+std::vector<std::vector<utils::observer_ptr<region>>> root::sort_layout_queue_() {
+    // Gather the queued regions, and all the regions which depend on them,
+    // counting the number of dependencies of each region within this set.
+    // NB: no callback is triggered here, so raw pointers remain valid.
+    std::vector<region*>                           node_list;
+    std::unordered_map<const region*, std::size_t> dependency_count;
+
+    for (const auto& obj : layout_queue_) {
+        if (!obj || !obj->is_borders_update_queued_)
+            continue;
+
+        if (dependency_count.emplace(obj.get(), 0u).second)
+            node_list.push_back(obj.get());
+    }
+
+    layout_queue_.clear();
+
+    for (std::size_t i = 0u; i < node_list.size(); ++i) {
+        for (const auto& anchored_obj : node_list[i]->anchored_object_list_) {
+            if (!anchored_obj)
+                continue;
+
+            auto [iter, inserted] = dependency_count.emplace(anchored_obj.get(), 0u);
+            ++iter->second;
+
+            if (inserted)
+                node_list.push_back(anchored_obj.get());
+        }
+    }
+
+    // Sort topologically (Kahn's algorithm), one level of dependency at a time:
+    // regions within a level do not depend on each other
+    std::vector<std::vector<utils::observer_ptr<region>>> level_list;
+    std::size_t                                           sorted_count = 0u;
+
+    std::vector<region*> ready_list;
+    for (auto* obj : node_list) {
+        if (dependency_count[obj] == 0u)
+            ready_list.push_back(obj);
+    }
+
+    std::vector<region*> next_ready_list;
+    while (!ready_list.empty()) {
+        auto& level = level_list.emplace_back();
+        level.reserve(ready_list.size());
+
+        for (auto* obj : ready_list) {
+            level.push_back(observer_from(obj));
+
+            for (const auto& anchored_obj : obj->anchored_object_list_) {
+                if (anchored_obj && --dependency_count[anchored_obj.get()] == 0u)
+                    next_ready_list.push_back(anchored_obj.get());
+            }
+        }
+
+        sorted_count += ready_list.size();
+        std::swap(ready_list, next_ready_list);
+        next_ready_list.clear();
+    }
+
+    if (sorted_count != node_list.size()) {
+        // This should not happen, since anchors cannot create cycles
+        gui::out << gui::warning << "gui::root: "
+                 << "Cyclic anchor dependency detected; layout may be incorrect." << std::endl;
+
+        auto& level = level_list.emplace_back();
+        for (auto* obj : node_list) {
+            if (dependency_count[obj] != 0u)
+                level.push_back(observer_from(obj));
+        }
+    }
+
+    return level_list;
+}
+
+void root::resolve_layout_level_(const std::vector<utils::observer_ptr<region>>& level) {
+    // Compute borders in parallel, when possible
+    constexpr std::size_t min_parallel_count = 64u;
+
+    layout_job_list_.clear();
+    if (layout_thread_pool_ && level.size() >= min_parallel_count) {
+        for (std::size_t i = 0u; i < level.size(); ++i) {
+            region* obj = level[i].get();
+            if (!obj || !obj->is_borders_update_queued_ ||
+                !obj->can_compute_borders_in_parallel_())
+                continue;
+
+            layout_job_list_.push_back(layout_job{
+                i, obj, obj->borders_, obj->is_valid_,
+                obj->get_effective_frame_renderer()->get_target_dimensions()});
+        }
+
+        if (layout_job_list_.size() < min_parallel_count)
+            layout_job_list_.clear();
+    }
+
+    if (!layout_job_list_.empty()) {
+        for (const auto& job : layout_job_list_) {
+            // Callbacks triggered below may queue these regions again
+            job.obj->is_borders_update_queued_ = false;
+        }
+
+        layout_thread_pool_->parallel_for(layout_job_list_.size(), [&](std::size_t i) {
+            const auto& job = layout_job_list_[i];
+            job.obj->compute_borders_(job.target_dimensions);
+        });
+    }
+
+    // Then update the other regions and send notifications on the main thread, in order
+    std::size_t job_index = 0u;
+    for (std::size_t i = 0u; i < level.size(); ++i) {
+        const auto& obj = level[i];
+
+        const layout_job* job = nullptr;
+        if (job_index < layout_job_list_.size() && layout_job_list_[job_index].index == i)
+            job = &layout_job_list_[job_index++];
+
+        // The region may have been destroyed by a callback
+        if (!obj)
+            continue;
+
+        bool     old_valid       = obj->is_valid_;
+        bounds2f old_border_list = obj->borders_;
+
+        if (job) {
+            old_valid       = job->old_valid;
+            old_border_list = job->old_border_list;
+            obj->notify_borders_updated_(old_border_list, old_valid);
+        } else {
+            if (!obj->is_borders_update_queued_)
+                continue;
+
+            obj->is_borders_update_queued_ = false;
+            obj->update_borders_();
+        }
+
+        if (!obj)
+            continue;
+
+        if (obj->borders_ != old_border_list || obj->is_valid_ != old_valid) {
+            // Regions anchored to this one come later in the sorted list
+            for (const auto& anchored_obj : obj->anchored_object_list_) {
+                if (anchored_obj)
+                    queue_borders_update(*anchored_obj);
+            }
+        }
+    }
+}
+
+void root::resolve_layout() {
+    if (is_resolving_layout_)
+        return;
+
+    is_resolving_layout_ = true;
+
+    // Callbacks triggered by border updates (e.g., OnSizeChanged) may queue other regions;
+    // process them in subsequent passes, but do not loop forever
+    constexpr std::size_t max_num_passes = 32u;
+    std::size_t           num_passes     = 0u;
+
+    while (!layout_queue_.empty()) {
+        if (num_passes == max_num_passes) {
+            gui::out << gui::warning << "gui::root: "
+                     << "Layout did not stabilize after " << max_num_passes << " passes."
+                     << std::endl;
+
+            for (const auto& obj : layout_queue_) {
+                if (obj)
+                    obj->is_borders_update_queued_ = false;
+            }
+
+            layout_queue_.clear();
+            break;
+        }
+
+        ++num_passes;
+
+        const auto level_list = sort_layout_queue_();
+        for (std::size_t i = 0u; i < level_list.size(); ++i) {
+            const std::size_t old_anchor_generation = anchor_generation_;
+
+            resolve_layout_level_(level_list[i]);
+
+            if (anchor_generation_ == old_anchor_generation)
+                continue;
+
+            // Callbacks have changed anchors, so regions in the remaining levels may now
+            // depend on each other: queue them again, to be sorted in the next pass
+            for (std::size_t j = i + 1u; j < level_list.size(); ++j) {
+                for (const auto& obj : level_list[j]) {
+                    if (obj && obj->is_borders_update_queued_)
+                        layout_queue_.push_back(obj);
+                }
+            }
+
+            break;
+        }
+    }
+
+    layout_job_list_.clear();
+
+    is_resolving_layout_ = false;
+
+    if (is_hovered_frame_dirty_ && layout_batch_depth_ == 0u) {
+        is_hovered_frame_dirty_ = false;
+        update_hovered_frame_();
+    }
+}
+
+void root::set_layout_thread_count(std::size_t thread_count) {
+    if (get_layout_thread_count() == thread_count)
+        return;
+
+    layout_thread_pool_ = nullptr;
+    if (thread_count != 0u)
+        layout_thread_pool_ = std::make_unique<utils::thread_pool>(thread_count);
+}
+
+std::size_t root::get_layout_thread_count() const {
+    return layout_thread_pool_ ? layout_thread_pool_->get_thread_count() : 0u;
+}
+
 void root::start_moving(
     utils::observer_ptr<region> obj,
     anchor*                     a,
@@ -518,11 +884,15 @@ void root::on_window_resized_(const vector2ui& dimensions) {
     screen_dimensions_ = dimensions;
 
     // Notify all frames anchored to the window edges
+    begin_layout_batch();
+
     for (auto& frame : get_root_frames()) {
         frame.notify_borders_need_update();
         frame.notify_renderer_need_redraw();
     }
 
+    end_layout_batch();
+
     // Resize caching render targets
     if (target_)
         create_caching_render_target_();
@@ -586,20 +956,24 @@ bool root::on_mouse_moved_(const input::mouse_moved_data& args) {
     }
 
     if (dragged_frame_) {
+        const vector2f local_position = dragged_frame_->to_local_position(args.position);
+
         event_data data;
         data.add(args.motion.x);
         data.add(args.motion.y);
-        data.add(args.position.x);
-        data.add(args.position.y);
+        data.add(local_position.x);
+        data.add(local_position.y);
         dragged_frame_->fire_script("OnDragMove", data);
     }
 
     if (hovered_frame_) {
+        const vector2f local_position = hovered_frame_->to_local_position(args.position);
+
         event_data data;
         data.add(args.motion.x);
         data.add(args.motion.y);
-        data.add(args.position.x);
-        data.add(args.position.y);
+        data.add(local_position.x);
+        data.add(local_position.y);
         hovered_frame_->fire_script("OnMouseMove", data);
         return true;
     }
@@ -614,10 +988,12 @@ bool root::on_mouse_wheel_(const input::mouse_wheel_data& args) {
     });
 
     if (hovered_frame) {
+        const vector2f local_position = hovered_frame->to_local_position(args.position);
+
         event_data data;
         data.add(args.motion);
-        data.add(args.position.x);
-        data.add(args.position.y);
+        data.add(local_position.x);
+        data.add(local_position.y);
         hovered_frame->fire_script("OnMouseWheel", data);
         return true;
     }
@@ -644,11 +1020,13 @@ bool root::on_drag_start_(const input::mouse_drag_start_data& args) {
     std::string button_name = std::string(input::get_mouse_button_codename(args.button));
 
     if (hovered_frame->is_drag_enabled(button_name)) {
+        const vector2f local_position = hovered_frame->to_local_position(args.position);
+
         event_data data;
         data.add(static_cast<std::underlying_type_t<input::key>>(args.button));
         data.add(button_name);
-        data.add(args.position.x);
-        data.add(args.position.y);
+        data.add(local_position.x);
+        data.add(local_position.y);
 
         dragged_frame_ = std::move(hovered_frame);
         dragged_frame_->fire_script("OnDragStart", data);
@@ -678,11 +1056,13 @@ bool root::on_drag_stop_(const input::mouse_drag_stop_data& args) {
     std::string button_name = std::string(input::get_mouse_button_codename(args.button));
 
     if (hovered_frame->is_drag_enabled(button_name)) {
+        const vector2f local_position = hovered_frame->to_local_position(args.position);
+
         event_data data;
         data.add(static_cast<std::underlying_type_t<input::key>>(args.button));
         data.add(button_name);
-        data.add(args.position.x);
-        data.add(args.position.y);
+        data.add(local_position.x);
+        data.add(local_position.y);
 
         hovered_frame->fire_script("OnReceiveDrag", data);
     }
@@ -808,11 +1188,13 @@ bool root::on_mouse_button_state_changed_(
         return false;
     }
 
+    const vector2f local_position = hovered_frame->to_local_position(mouse_pos);
+
     event_data data;
     data.add(static_cast<std::underlying_type_t<input::key>>(button_id));
     data.add(std::string(input::get_mouse_button_codename(button_id)));
-    data.add(mouse_pos.x);
-    data.add(mouse_pos.y);
+    data.add(local_position.x);
+    data.add(local_position.y);
 
     if (is_double_click) {
         hovered_frame->fire_script("OnDoubleClick", data);
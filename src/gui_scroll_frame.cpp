@@ -7,8 +7,11 @@
 #include "lxgui/gui_region_tpl.hpp"
 #include "lxgui/gui_render_target.hpp"
 #include "lxgui/gui_renderer.hpp"
+#include "lxgui/gui_root.hpp"
 #include "lxgui/gui_texture.hpp"
 
+#include <algorithm>
+
 namespace lxgui::gui {
 
 scroll_frame::scroll_frame(
@@ -58,6 +61,8 @@ void scroll_frame::copy_from(const region& obj) {
     if (!scroll_obj)
         return;
 
+    this->set_translation_scroll_enabled(scroll_obj->is_translation_scroll_enabled());
+    this->set_scissor_clipping_enabled(scroll_obj->is_scissor_clipping_enabled());
     this->set_horizontal_scroll(scroll_obj->get_horizontal_scroll());
     this->set_vertical_scroll(scroll_obj->get_vertical_scroll());
 
@@ -109,8 +114,11 @@ void scroll_frame::set_scroll_child(utils::owner_ptr<frame> obj) {
             scroll_child_->set_frame_renderer(observer_from(this));
 
         scroll_child_->clear_all_anchors();
-        if (!is_virtual())
-            scroll_child_->set_anchor(point::top_left, get_name(), -scroll_);
+        if (!is_virtual()) {
+            scroll_child_->set_anchor(
+                point::top_left, get_name(),
+                is_translation_scroll_enabled_ ? vector2f::zero : -scroll_);
+        }
 
         scroll_child_on_resize_connection_ = scroll_child_->add_script(
             "OnSizeChanged", [&](frame&, const event_data&) { update_scroll_range_(); });
@@ -132,10 +140,7 @@ void scroll_frame::set_horizontal_scroll(float horizontal_scroll) {
     if (!checker.is_alive())
         return;
 
-    scroll_child_->modify_anchor(point::top_left).offset = -scroll_;
-    scroll_child_->notify_borders_need_update();
-
-    redraw_scroll_render_target_flag_ = true;
+    update_scroll_offset_();
 }
 
 float scroll_frame::get_horizontal_scroll() const {
@@ -157,10 +162,7 @@ void scroll_frame::set_vertical_scroll(float vertical_scroll) {
     if (!checker.is_alive())
         return;
 
-    scroll_child_->modify_anchor(point::top_left).offset = -scroll_;
-    scroll_child_->notify_borders_need_update();
-
-    redraw_scroll_render_target_flag_ = true;
+    update_scroll_offset_();
 }
 
 float scroll_frame::get_vertical_scroll() const {
@@ -171,6 +173,120 @@ float scroll_frame::get_vertical_scroll_range() const {
     return scroll_range_.y;
 }
 
+void scroll_frame::set_translation_scroll_enabled(bool enabled) {
+    if (is_translation_scroll_enabled_ == enabled)
+        return;
+
+    is_translation_scroll_enabled_ = enabled;
+    scroll_cache_origin_           = vector2f::zero;
+
+    if (scroll_child_ && !is_virtual()) {
+        scroll_child_->modify_anchor(point::top_left).offset = enabled ? vector2f::zero : -scroll_;
+        scroll_child_->notify_borders_need_update();
+    }
+
+    rebuild_scroll_render_target_();
+
+    if (!is_virtual())
+        get_manager().get_root().notify_hovered_frame_dirty();
+}
+
+bool scroll_frame::is_translation_scroll_enabled() const {
+    return is_translation_scroll_enabled_;
+}
+
+void scroll_frame::set_scissor_clipping_enabled(bool enabled) {
+    if (is_scissor_clipping_enabled_ == enabled)
+        return;
+
+    is_scissor_clipping_enabled_ = enabled;
+
+    rebuild_scroll_render_target_();
+}
+
+bool scroll_frame::is_scissor_clipping_enabled() const {
+    return is_scissor_clipping_enabled_;
+}
+
+bool scroll_frame::uses_render_target_() const {
+    // Translation-only scrolling relies on the render target to cache the content
+    return is_translation_scroll_enabled_ || !is_scissor_clipping_enabled_ ||
+           !get_manager().get_renderer().is_scissor_supported();
+}
+
+void scroll_frame::update_scroll_offset_() {
+    if (!scroll_child_)
+        return;
+
+    if (!is_translation_scroll_enabled_) {
+        scroll_child_->modify_anchor(point::top_left).offset = -scroll_;
+        scroll_child_->notify_borders_need_update();
+
+        redraw_scroll_render_target_flag_ = true;
+        return;
+    }
+
+    // Only re-render the content if the visible area is no longer in the render target
+    if (is_in_scroll_cache_())
+        update_scroll_texture_rect_();
+    else
+        redraw_scroll_render_target_flag_ = true;
+
+    // Borders are unchanged, but the mouse may now be over another frame
+    if (!is_virtual())
+        get_manager().get_root().notify_hovered_frame_dirty();
+}
+
+vector2f scroll_frame::get_scroll_cache_size_() const {
+    const vector2f apparent_size = get_apparent_dimensions();
+    if (!is_translation_scroll_enabled_)
+        return apparent_size;
+
+    // Render up to one extra visible area of content, split around the visible area
+    return apparent_size + vector2f(
+                               std::min(apparent_size.x, scroll_range_.x),
+                               std::min(apparent_size.y, scroll_range_.y));
+}
+
+bool scroll_frame::is_in_scroll_cache_() const {
+    const vector2f margin = get_scroll_cache_size_() - get_apparent_dimensions();
+
+    return scroll_.x >= scroll_cache_origin_.x && scroll_.x <= scroll_cache_origin_.x + margin.x &&
+           scroll_.y >= scroll_cache_origin_.y && scroll_.y <= scroll_cache_origin_.y + margin.y;
+}
+
+void scroll_frame::update_scroll_cache_origin_() {
+    const vector2f margin = get_scroll_cache_size_() - get_apparent_dimensions();
+
+    // Center the visible area in the cache, without rendering beyond the content
+    // (unless the scroll value is itself out of range)
+    auto get_origin = [](float value, float range, float extra) {
+        return std::clamp(
+            value - extra / 2.0f, std::min(value, 0.0f), std::max(value - extra, range - extra));
+    };
+
+    scroll_cache_origin_.x = get_origin(scroll_.x, scroll_range_.x, margin.x);
+    scroll_cache_origin_.y = get_origin(scroll_.y, scroll_range_.y, margin.y);
+}
+
+void scroll_frame::update_scroll_texture_rect_() {
+    if (!scroll_texture_)
+        return;
+
+    if (!is_translation_scroll_enabled_) {
+        scroll_texture_->set_tex_rect(std::array<float, 4>{0.0f, 0.0f, 1.0f, 1.0f});
+        return;
+    }
+
+    const vector2f cache_size   = get_scroll_cache_size_();
+    const vector2f top_left     = scroll_ - scroll_cache_origin_;
+    const vector2f bottom_right = top_left + get_apparent_dimensions();
+
+    scroll_texture_->set_tex_rect(std::array<float, 4>{
+        top_left.x / cache_size.x, top_left.y / cache_size.y, bottom_right.x / cache_size.x,
+        bottom_right.y / cache_size.y});
+}
+
 void scroll_frame::update_(float delta) {
     alive_checker checker(*this);
     base::update_(delta);
@@ -192,6 +308,7 @@ void scroll_frame::update_scroll_range_() {
     const vector2f apparent_size       = get_apparent_dimensions();
     const vector2f child_apparent_size = scroll_child_->get_apparent_dimensions();
     const auto     old_scroll_range    = scroll_range_;
+    const auto     old_cache_size      = get_scroll_cache_size_();
 
     scroll_range_ = child_apparent_size - apparent_size;
 
@@ -200,6 +317,9 @@ void scroll_frame::update_scroll_range_() {
     if (scroll_range_.y < 0)
         scroll_range_.y = 0;
 
+    if (get_scroll_cache_size_() != old_cache_size)
+        rebuild_scroll_render_target_();
+
     if (!is_virtual() && scroll_range_ != old_scroll_range) {
         alive_checker checker(*this);
         fire_script("OnScrollRangeChanged");
@@ -218,18 +338,32 @@ void scroll_frame::rebuild_scroll_render_target_() {
     if (!scroll_texture_)
         return;
 
-    const vector2f apparent_size = get_apparent_dimensions();
+    if (!uses_render_target_()) {
+        // The scroll child is rendered directly, see render_layered_regions_()
+        if (scroll_render_target_) {
+            scroll_render_target_ = nullptr;
+            scroll_texture_->set_texture(std::shared_ptr<render_target>{});
+        }
 
-    if (apparent_size.x <= 0 || apparent_size.y <= 0)
+        scroll_texture_->hide();
+        notify_renderer_need_redraw();
+        return;
+    }
+
+    scroll_texture_->show();
+
+    const vector2f cache_size = get_scroll_cache_size_();
+
+    if (cache_size.x <= 0 || cache_size.y <= 0)
         return;
 
     float     factor = get_manager().get_interface_scaling_factor();
     vector2ui scaled_size =
-        vector2ui(std::round(apparent_size.x * factor), std::round(apparent_size.y * factor));
+        vector2ui(std::round(cache_size.x * factor), std::round(cache_size.y * factor));
 
     if (scroll_render_target_) {
         scroll_render_target_->set_dimensions(scaled_size);
-        scroll_texture_->set_tex_rect(std::array<float, 4>{0.0f, 0.0f, 1.0f, 1.0f});
+        update_scroll_texture_rect_();
     } else {
         auto& renderer        = get_manager().get_renderer();
         scroll_render_target_ = renderer.create_render_target(scaled_size);
@@ -246,6 +380,30 @@ void scroll_frame::rebuild_scroll_render_target_() {
     }
 }
 
+void scroll_frame::render_layered_regions_(const bounds2f* clip_bounds) const {
+    if (!scroll_child_ || uses_render_target_()) {
+        base::render_layered_regions_(clip_bounds);
+        return;
+    }
+
+    // Render the scroll child below the artwork layer, where the scroll texture would be
+    render_layers_(layer::background, layer::border, clip_bounds);
+
+    // The scroll child is entirely within the borders of this frame
+    if (!clip_bounds || borders_.overlaps(*clip_bounds)) {
+        renderer& rdr = manager_.get_renderer();
+        rdr.push_clip_rect(borders_);
+
+        for (const auto& s : strata_list_) {
+            render_strata_(s, borders_);
+        }
+
+        rdr.pop_clip_rect();
+    }
+
+    render_layers_(layer::artwork, layer::special_high, clip_bounds);
+}
+
 void scroll_frame::render_scroll_strata_list_() {
     renderer& renderer = get_manager().get_renderer();
 
@@ -254,23 +412,53 @@ void scroll_frame::render_scroll_strata_list_() {
     vector2f view = vector2f(scroll_render_target_->get_canvas_dimensions()) /
                     get_manager().get_interface_scaling_factor();
 
-    renderer.set_view(matrix4f::translation(-get_borders().top_left()) * matrix4f::view(view));
+    vector2f view_origin = get_borders().top_left();
+    if (is_translation_scroll_enabled_) {
+        if (!is_in_scroll_cache_())
+            update_scroll_cache_origin_();
+
+        view_origin += scroll_cache_origin_;
+    }
+
+    renderer.set_view(matrix4f::translation(-view_origin) * matrix4f::view(view));
 
     scroll_render_target_->clear(color::empty);
 
+    // Only render what fits in the render target
+    const vector2f cache_size = get_scroll_cache_size_();
+    const bounds2f cache_bounds(
+        view_origin.x, view_origin.x + cache_size.x, view_origin.y, view_origin.y + cache_size.y);
+
     for (const auto& s : strata_list_) {
-        render_strata_(s);
+        render_strata_(s, cache_bounds);
     }
 
     renderer.end();
 
+    if (is_translation_scroll_enabled_)
+        update_scroll_texture_rect_();
+
     notify_renderer_need_redraw();
 }
 
 utils::observer_ptr<const frame>
 scroll_frame::find_topmost_frame(const std::function<bool(const frame&)>& predicate) const {
     if (base::find_topmost_frame(predicate)) {
-        if (auto hovered_frame = frame_renderer::find_topmost_frame(predicate))
+        utils::observer_ptr<const frame> hovered_frame;
+        if (is_translation_scroll_enabled_) {
+            // Ignore frames outside of the visible area
+            const vector2f visible_origin = get_borders().top_left() + scroll_;
+            const vector2f apparent_size  = get_apparent_dimensions();
+            const bounds2f visible_bounds(
+                visible_origin.x, visible_origin.x + apparent_size.x, visible_origin.y,
+                visible_origin.y + apparent_size.y);
+
+            hovered_frame = find_topmost_frame_(predicate, visible_bounds);
+        } else {
+            hovered_frame = frame_renderer::find_topmost_frame(predicate);
+        }
+
+        if (hovered_frame)
             return hovered_frame;
 
         return observer_from(this);
@@ -282,12 +470,24 @@ scroll_frame::find_topmost_frame(const std::function<bool(const frame&)>& predic
 void scroll_frame::notify_strata_needs_redraw(strata strata_id) {
     frame_renderer::notify_strata_needs_redraw(strata_id);
     redraw_scroll_render_target_flag_ = true;
+
+    // Without a render target, the scroll child is redrawn along with this frame
+    if (!uses_render_target_())
+        notify_renderer_need_redraw();
 }
 
 vector2f scroll_frame::get_target_dimensions() const {
     return get_apparent_dimensions();
 }
 
+vector2f scroll_frame::get_render_offset() const {
+    const vector2f offset = get_effective_frame_renderer()->get_render_offset();
+    if (is_translation_scroll_enabled_)
+        return offset - scroll_;
+
+    return offset;
+}
+
 const std::vector<std::string>& scroll_frame::get_type_list_() const {
     return get_type_list_impl_<scroll_frame>();
 }
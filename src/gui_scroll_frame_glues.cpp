@@ -29,7 +29,7 @@
  *
  * Inherits all methods from: @{Region}, @{Frame}.
  *
- * Child classes: none.
+ * Child classes: @{ListView}.
  * @classmod ScrollFrame
  */
 
@@ -68,11 +68,29 @@ void scroll_frame::register_on_lua(sol::state& lua) {
     type.set_function(
         "get_vertical_scroll_range", member_function<&scroll_frame::get_vertical_scroll_range>());
 
+    /** @function is_scissor_clipping_enabled
+     */
+    type.set_function(
+        "is_scissor_clipping_enabled",
+        member_function<&scroll_frame::is_scissor_clipping_enabled>());
+
+    /** @function is_translation_scroll_enabled
+     */
+    type.set_function(
+        "is_translation_scroll_enabled",
+        member_function<&scroll_frame::is_translation_scroll_enabled>());
+
     /** @function set_horizontal_scroll
      */
     type.set_function(
         "set_horizontal_scroll", member_function<&scroll_frame::set_horizontal_scroll>());
 
+    /** @function set_scissor_clipping_enabled
+     */
+    type.set_function(
+        "set_scissor_clipping_enabled",
+        member_function<&scroll_frame::set_scissor_clipping_enabled>());
+
     /** @function set_scroll_child
      */
     type.set_function(
@@ -86,6 +104,12 @@ void scroll_frame::register_on_lua(sol::state& lua) {
             self.set_scroll_child(std::move(scroll_child));
         });
 
+    /** @function set_translation_scroll_enabled
+     */
+    type.set_function(
+        "set_translation_scroll_enabled",
+        member_function<&scroll_frame::set_translation_scroll_enabled>());
+
     /** @function set_vertical_scroll
      */
     type.set_function("set_vertical_scroll", member_function<&scroll_frame::set_vertical_scroll>());
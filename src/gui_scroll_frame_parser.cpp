@@ -5,6 +5,16 @@
 
 namespace lxgui::gui {
 
+void scroll_frame::parse_attributes_(const layout_node& node) {
+    frame::parse_attributes_(node);
+
+    if (const auto attr = node.try_get_attribute_value<bool>("translationScroll"))
+        set_translation_scroll_enabled(attr.value());
+
+    if (const auto attr = node.try_get_attribute_value<bool>("scissorClipping"))
+        set_scissor_clipping_enabled(attr.value());
+}
+
 void scroll_frame::parse_all_nodes_before_children_(const layout_node& node) {
     frame::parse_all_nodes_before_children_(node);
     parse_scroll_child_node_(node);
@@ -53,8 +53,9 @@ void slider::fire_script(const std::string& script_name, const event_data& data)
         return;
 
     if (script_name == "OnDragStart") {
-        if (thumb_texture_ &&
-            thumb_texture_->is_in_region({data.get<float>(2), data.get<float>(3)})) {
+        // NB: the mouse position is in the coordinates of the borders, see to_local_position()
+        const vector2f position(data.get<float>(2), data.get<float>(3));
+        if (thumb_texture_ && thumb_texture_->get_borders().contains(position)) {
             anchor& a = thumb_texture_->modify_anchor(point::center);
 
             get_manager().get_root().start_moving(
@@ -338,8 +339,12 @@ void slider::update_thumb_texture_() {
     constrain_thumb_();
 }
 
-void slider::notify_borders_need_update() {
-    base::notify_borders_need_update();
+void slider::notify_borders_updated_(const bounds2f& old_border_list, bool old_valid) {
+    alive_checker checker(*this);
+    base::notify_borders_updated_(old_border_list, old_valid);
+    if (!checker.is_alive())
+        return;
+
     notify_thumb_texture_needs_update_();
 }
 
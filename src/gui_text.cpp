@@ -373,12 +373,12 @@ void text::set_box_height(float box_height) {
 
 float text::get_width() const {
     update_();
-    return width_;
+    return layout_ ? layout_->width : 0.0f;
 }
 
 float text::get_height() const {
     update_();
-    return height_;
+    return layout_ ? layout_->height : 0.0f;
 }
 
 float text::get_box_width() const {
@@ -405,7 +405,7 @@ float text::get_text_height() const {
 
 std::size_t text::get_line_count() const {
     update_();
-    return num_lines_;
+    return layout_ ? layout_->num_lines : 0u;
 }
 
 float text::get_string_width(const std::string& content) const {
@@ -530,7 +530,7 @@ void text::set_formatting_enabled(bool formatting) {
 
     formatting_enabled_ = formatting;
 
-    notify_vertex_cache_dirty_();
+    notify_cache_dirty_();
 }
 
 void text::set_use_vertex_cache(bool use_vertex_cache) {
@@ -551,6 +551,9 @@ void text::render(const matrix4f& transform) const {
 
     update_();
 
+    if (!layout_)
+        return;
+
     bool use_vertex_cache = use_vertex_cache_();
     if (use_vertex_cache) {
         update_vertex_cache_();
@@ -561,7 +564,7 @@ void text::render(const matrix4f& transform) const {
             if (use_vertex_cache && outline_vertex_cache_) {
                 renderer_.render_cache(mat.get(), *outline_vertex_cache_, transform);
             } else {
-                std::vector<std::array<vertex, 4>> quads_copy = outline_quad_list_;
+                std::vector<std::array<vertex, 4>> quads_copy = layout_->outline_quad_list;
                 for (auto& quad : quads_copy) {
                     for (std::size_t i = 0; i < 4; ++i) {
                         quad[i].pos = quad[i].pos * transform;
@@ -578,7 +581,7 @@ void text::render(const matrix4f& transform) const {
         if (use_vertex_cache && vertex_cache_) {
             renderer_.render_cache(mat.get(), *vertex_cache_, transform);
         } else {
-            std::vector<std::array<vertex, 4>> quads_copy = quad_list_;
+            std::vector<std::array<vertex, 4>> quads_copy = layout_->quad_list;
             for (auto& quad : quads_copy) {
                 for (std::size_t i = 0; i < 4; ++i) {
                     quad[i].pos = quad[i].pos * transform;
@@ -594,7 +597,7 @@ void text::render(const matrix4f& transform) const {
             renderer_.render_quads(mat.get(), quads_copy);
         }
 
-        for (auto quad : icons_list_) {
+        for (auto quad : layout_->icons_list) {
             for (std::size_t i = 0; i < 4; ++i) {
                 quad.v[i].pos = quad.v[i].pos * transform;
                 quad.v[i].col.a *= alpha_;
@@ -621,6 +624,47 @@ void text::update_() const {
     if (!font_ || !update_cache_flag_)
         return;
 
+    text_layout_key key;
+    key.fnt                    = font_.get();
+    key.outline_fnt            = outline_font_.get();
+    key.content                = unicode_text_;
+    key.scaling_factor         = scaling_factor_;
+    key.tracking               = tracking_;
+    key.line_spacing           = line_spacing_;
+    key.remove_starting_spaces = remove_starting_spaces_;
+    key.word_wrap_enabled      = word_wrap_enabled_;
+    key.ellipsis_enabled       = ellipsis_enabled_;
+    key.formatting_enabled     = formatting_enabled_;
+    key.box_width              = box_width_;
+    key.box_height             = box_height_;
+    key.align_x                = align_x_;
+    key.align_y                = align_y_;
+
+    // Share the layout with other texts displaying the same content, if any
+    text_layout_cache& cache = renderer_.get_text_layout_cache();
+
+    std::shared_ptr<const text_layout> layout = cache.find(key);
+    if (!layout) {
+        layout = create_layout_();
+        cache.insert(key, layout);
+    }
+
+    if (layout != layout_) {
+        layout_ = std::move(layout);
+        vertex_cache_.reset();
+        outline_vertex_cache_.reset();
+    }
+
+    update_cache_flag_ = false;
+
+    notify_vertex_cache_dirty_();
+}
+
+std::shared_ptr<text_layout> text::create_layout_() const {
+    auto layout         = std::make_shared<text_layout>();
+    layout->fnt         = font_;
+    layout->outline_fnt = outline_font_;
+
     // Update the line list, read format tags, do word wrapping, ...
     std::vector<parser::line> line_list;
 
@@ -835,21 +879,17 @@ void text::update_() const {
         }
     }
 
-    num_lines_ = line_list.size();
-
-    quad_list_.clear();
-    outline_quad_list_.clear();
-    icons_list_.clear();
+    layout->num_lines = line_list.size();
 
     if (!line_list.empty()) {
         if (box_width_ == 0.0f || std::isinf(box_width_)) {
-            width_ = 0.0f;
+            layout->width = 0.0f;
             for (const auto& line : line_list)
-                width_ = std::max(width_, line.width);
+                layout->width = std::max(layout->width, line.width);
         } else
-            width_ = box_width_;
+            layout->width = box_width_;
 
-        height_ =
+        layout->height =
             (1.0f + static_cast<float>(line_list.size() - 1) * line_spacing_) * get_line_height();
 
         float y  = 0.0f;
@@ -867,14 +907,14 @@ void text::update_() const {
         if (!std::isinf(box_height_)) {
             switch (align_y_) {
             case alignment_y::top: y = 0.0f; break;
-            case alignment_y::middle: y = (box_height_ - height_) * 0.5f; break;
-            case alignment_y::bottom: y = (box_height_ - height_); break;
+            case alignment_y::middle: y = (box_height_ - layout->height) * 0.5f; break;
+            case alignment_y::bottom: y = (box_height_ - layout->height); break;
             }
         } else {
             switch (align_y_) {
             case alignment_y::top: y = 0.0f; break;
-            case alignment_y::middle: y = -height_ * 0.5f; break;
-            case alignment_y::bottom: y = -height_; break;
+            case alignment_y::middle: y = -layout->height * 0.5f; break;
+            case alignment_y::bottom: y = -layout->height; break;
             }
         }
 
@@ -937,7 +977,7 @@ void text::update_() const {
                                 icon.v[i].pos += vector2f(round_to_pixel_(x), round_to_pixel_(y));
                             }
 
-                            icons_list_.push_back(icon);
+                            layout->icons_list.push_back(icon);
                         } else if constexpr (std::is_same_v<type, char32_t>) {
                             if (outline_font_) {
                                 std::array<vertex, 4> vertex_list =
@@ -948,7 +988,7 @@ void text::update_() const {
                                     vertex_list[i].col = color::black;
                                 }
 
-                                outline_quad_list_.push_back(vertex_list);
+                                layout->outline_quad_list.push_back(vertex_list);
                             }
 
                             std::array<vertex, 4> vertex_list = create_letter_quad_(value);
@@ -959,7 +999,7 @@ void text::update_() const {
                                     color_stack.empty() ? color::empty : color_stack.back();
                             }
 
-                            quad_list_.push_back(vertex_list);
+                            layout->quad_list.push_back(vertex_list);
                         }
                     },
                     *iter_char);
@@ -969,24 +1009,47 @@ void text::update_() const {
 
             y += get_line_height() * line_spacing_;
         }
-    } else {
-        width_  = 0.0f;
-        height_ = 0.0f;
     }
 
-    update_cache_flag_ = false;
-
-    notify_vertex_cache_dirty_();
+    return layout;
 }
 
 void text::update_vertex_cache_() const {
-    if (!update_vertex_cache_flag_)
+    if (!update_vertex_cache_flag_ || !layout_)
         return;
 
-    if (!vertex_cache_)
-        vertex_cache_ = renderer_.create_vertex_cache(vertex_cache::type::quads);
+    // Look for vertex caches with the same colors, shared with other texts
+    auto& cache_list = layout_->colored_cache_list;
+    for (const auto& colored : cache_list) {
+        if (colored.col == color_ && colored.force_color == force_color_ &&
+            colored.alpha == alpha_) {
+            vertex_cache_             = colored.cache;
+            outline_vertex_cache_     = colored.outline_cache;
+            update_vertex_cache_flag_ = false;
+            return;
+        }
+    }
+
+    text_layout::colored_cache colored;
+    if (cache_list.size() >= text_layout_cache::max_colored_caches) {
+        // Recycle the oldest vertex caches, if no other text is using them
+        colored = std::move(cache_list.front());
+        cache_list.erase(cache_list.begin());
 
-    std::vector<std::array<vertex, 4>> quads_copy = quad_list_;
+        if (colored.cache.use_count() > 1)
+            colored.cache = nullptr;
+        if (colored.outline_cache.use_count() > 1)
+            colored.outline_cache = nullptr;
+    }
+
+    colored.col         = color_;
+    colored.force_color = force_color_;
+    colored.alpha       = alpha_;
+
+    if (!colored.cache)
+        colored.cache = renderer_.create_vertex_cache(vertex_cache::type::quads);
+
+    std::vector<std::array<vertex, 4>> quads_copy = layout_->quad_list;
     for (auto& quad : quads_copy) {
         for (std::size_t i = 0; i < 4; ++i) {
             if (!formatting_enabled_ || force_color_ || quad[i].col == color::empty) {
@@ -997,27 +1060,38 @@ void text::update_vertex_cache_() const {
         }
     }
 
-    vertex_cache_->update(quads_copy[0].data(), quads_copy.size() * 4);
+    if (!quads_copy.empty())
+        colored.cache->update(quads_copy[0].data(), quads_copy.size() * 4);
 
     if (outline_font_) {
-        if (!outline_vertex_cache_)
-            outline_vertex_cache_ = renderer_.create_vertex_cache(vertex_cache::type::quads);
+        if (!colored.outline_cache)
+            colored.outline_cache = renderer_.create_vertex_cache(vertex_cache::type::quads);
 
-        std::vector<std::array<vertex, 4>> outline_quads_copy = outline_quad_list_;
+        std::vector<std::array<vertex, 4>> outline_quads_copy = layout_->outline_quad_list;
         for (auto& quad : outline_quads_copy) {
             for (std::size_t i = 0; i < 4; ++i) {
                 quad[i].col.a *= alpha_;
             }
         }
 
-        outline_vertex_cache_->update(outline_quads_copy[0].data(), outline_quads_copy.size() * 4);
+        if (!outline_quads_copy.empty()) {
+            colored.outline_cache->update(
+                outline_quads_copy[0].data(), outline_quads_copy.size() * 4);
+        }
     }
 
+    vertex_cache_         = colored.cache;
+    outline_vertex_cache_ = colored.outline_cache;
+    cache_list.push_back(std::move(colored));
+
     update_vertex_cache_flag_ = false;
 }
 
 std::array<vertex, 4> text::create_letter_quad_(const gui::font& font, char32_t c) const {
-    bounds2f quad = font.get_character_bounds(c) * scaling_factor_;
+    gui::font::character_metrics metrics;
+    font.get_character_metrics(&c, 1u, &metrics);
+
+    bounds2f quad = metrics.bounds * scaling_factor_;
 
     std::array<vertex, 4> vertex_list;
     vertex_list[0].pos = quad.top_left();
@@ -1025,7 +1099,7 @@ std::array<vertex, 4> text::create_letter_quad_(const gui::font& font, char32_t
     vertex_list[2].pos = quad.bottom_right();
     vertex_list[3].pos = quad.bottom_left();
 
-    bounds2f uvs       = font.get_character_uvs(c);
+    const bounds2f& uvs = metrics.uvs;
     vertex_list[0].uvs = uvs.top_left();
     vertex_list[1].uvs = uvs.top_right();
     vertex_list[2].uvs = uvs.bottom_right();
@@ -1052,16 +1126,16 @@ quad text::create_letter_quad(char32_t c) const {
 
 std::size_t text::get_letter_count() const {
     update_();
-    return quad_list_.size();
+    return layout_ ? layout_->quad_list.size() : 0u;
 }
 
 const std::array<vertex, 4>& text::get_letter_quad(std::size_t index) const {
     update_();
 
-    if (index >= quad_list_.size())
+    if (!layout_ || index >= layout_->quad_list.size())
         throw gui::exception("text", "Trying to access letter at invalid index.");
 
-    return quad_list_[index];
+    return layout_->quad_list[index];
 }
 
 } // namespace lxgui::gui
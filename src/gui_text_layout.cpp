@@ -0,0 +1,74 @@
+#include "lxgui/gui_text_layout.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <string_view>
+
+namespace lxgui::gui {
+
+namespace {
+
+template<typename T>
+void combine_hash(std::size_t& seed, const T& value) {
+    seed ^= std::hash<T>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+} // namespace
+
+bool text_layout_key::operator==(const text_layout_key& other) const {
+    return fnt == other.fnt && outline_fnt == other.outline_fnt &&
+           scaling_factor == other.scaling_factor && tracking == other.tracking &&
+           line_spacing == other.line_spacing &&
+           remove_starting_spaces == other.remove_starting_spaces &&
+           word_wrap_enabled == other.word_wrap_enabled &&
+           ellipsis_enabled == other.ellipsis_enabled &&
+           formatting_enabled == other.formatting_enabled && box_width == other.box_width &&
+           box_height == other.box_height && align_x == other.align_x &&
+           align_y == other.align_y && content == other.content;
+}
+
+std::size_t text_layout_cache::key_hash::operator()(const text_layout_key& key) const {
+    std::size_t seed = std::hash<std::u32string_view>{}(key.content);
+    combine_hash(seed, key.fnt);
+    combine_hash(seed, key.outline_fnt);
+    combine_hash(seed, key.scaling_factor);
+    combine_hash(seed, key.box_width);
+    combine_hash(seed, key.box_height);
+    combine_hash(seed, static_cast<int>(key.align_x));
+    combine_hash(seed, static_cast<int>(key.align_y));
+    return seed;
+}
+
+std::shared_ptr<const text_layout> text_layout_cache::find(const text_layout_key& key) const {
+    auto iter = layout_list_.find(key);
+    if (iter == layout_list_.end())
+        return nullptr;
+
+    return iter->second.lock();
+}
+
+void text_layout_cache::insert(
+    const text_layout_key& key, const std::shared_ptr<const text_layout>& layout) {
+    layout_list_[key] = layout;
+
+    // Layouts are not removed from the cache when destroyed; clean up regularly
+    if (layout_list_.size() >= next_prune_size_) {
+        prune();
+        next_prune_size_ = std::max<std::size_t>(64u, 2u * layout_list_.size());
+    }
+}
+
+void text_layout_cache::prune() {
+    for (auto iter = layout_list_.begin(); iter != layout_list_.end();) {
+        if (iter->second.expired())
+            iter = layout_list_.erase(iter);
+        else
+            ++iter;
+    }
+}
+
+std::size_t text_layout_cache::get_size() const {
+    return layout_list_.size();
+}
+
+} // namespace lxgui::gui
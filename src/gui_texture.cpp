@@ -389,8 +389,8 @@ void texture::set_vertex_color(const color& c, std::size_t index) {
     notify_renderer_need_redraw();
 }
 
-void texture::update_borders_() {
-    base::update_borders_();
+void texture::notify_borders_updated_(const bounds2f& old_border_list, bool old_valid) {
+    base::notify_borders_updated_(old_border_list, old_valid);
 
     quad_.v[0].pos = borders_.top_left();
     quad_.v[1].pos = borders_.top_right();
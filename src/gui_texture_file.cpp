@@ -0,0 +1,101 @@
+#include "lxgui/gui_texture_file.hpp"
+
+#include "lxgui/gui_exception.hpp"
+#include "lxgui/utils_string.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+
+namespace lxgui::gui {
+
+namespace {
+std::size_t get_level_size(const vector2ui& dimensions, std::size_t level) {
+    return std::max<std::size_t>(dimensions.x >> level, 1u) *
+           std::max<std::size_t>(dimensions.y >> level, 1u);
+}
+} // namespace
+
+texture_file::texture_file(const std::string& file_name) : file_(file_name) {
+    if (file_.get_size() < sizeof(header)) {
+        throw gui::exception(
+            "gui::texture_file", "'" + file_name + "' is not a valid texture file.");
+    }
+
+    const char expected_magic[4] = {'L', 'X', 'T', 'X'};
+
+    header head;
+    std::memcpy(&head, file_.get_data(), sizeof(header));
+    if (std::memcmp(head.magic, expected_magic, sizeof(expected_magic)) != 0) {
+        throw gui::exception(
+            "gui::texture_file", "'" + file_name + "' is not a valid texture file.");
+    }
+
+    if (head.version != 1u) {
+        throw gui::exception(
+            "gui::texture_file", "'" + file_name + "' has an unsupported version (" +
+                                     utils::to_string(head.version) + ").");
+    }
+
+    if ((head.flags & premultiplied_alpha) == 0u) {
+        throw gui::exception(
+            "gui::texture_file", "'" + file_name + "' must be stored with pre-multiplied alpha.");
+    }
+
+    dimensions_ = vector2ui(head.width, head.height);
+    num_levels_ = head.num_levels;
+
+    if (dimensions_.x == 0u || dimensions_.y == 0u || num_levels_ == 0u || num_levels_ > 32u) {
+        throw gui::exception("gui::texture_file", "'" + file_name + "' has invalid dimensions.");
+    }
+
+    // The header is not trusted: check the size of each level, and the total, for overflows
+    constexpr std::size_t max_size      = std::numeric_limits<std::size_t>::max();
+    std::size_t           expected_size = sizeof(header);
+    for (std::size_t level = 0u; level < num_levels_; ++level) {
+        const vector2ui level_dimensions = get_level_dimensions(level);
+        if (level_dimensions.x > max_size / sizeof(color32) / level_dimensions.y) {
+            throw gui::exception("gui::texture_file", "'" + file_name + "' is too large.");
+        }
+
+        const std::size_t level_size = get_level_size(dimensions_, level) * sizeof(color32);
+        if (level_size > max_size - expected_size) {
+            throw gui::exception("gui::texture_file", "'" + file_name + "' is too large.");
+        }
+
+        expected_size += level_size;
+    }
+
+    if (file_.get_size() < expected_size) {
+        throw gui::exception("gui::texture_file", "'" + file_name + "' is truncated.");
+    }
+}
+
+const vector2ui& texture_file::get_dimensions() const {
+    return dimensions_;
+}
+
+std::size_t texture_file::get_num_levels() const {
+    return num_levels_;
+}
+
+vector2ui texture_file::get_level_dimensions(std::size_t level) const {
+    return vector2ui(
+        std::max<std::size_t>(dimensions_.x >> level, 1u),
+        std::max<std::size_t>(dimensions_.y >> level, 1u));
+}
+
+const color32* texture_file::get_level_data(std::size_t level) const {
+    std::size_t offset = sizeof(header);
+    for (std::size_t i = 0u; i < level; ++i)
+        offset += get_level_size(dimensions_, i) * sizeof(color32);
+
+    return reinterpret_cast<const color32*>(file_.get_data() + offset);
+}
+
+std::string texture_file::get_file_name(const std::string& file_name) {
+    return std::filesystem::path(file_name).replace_extension(".lxtex").u8string();
+}
+
+} // namespace lxgui::gui
@@ -9,101 +9,212 @@
 #include "lxgui/utils_string.hpp"
 
 #include <iostream>
+#include <limits>
 
 namespace lxgui::input {
 
 dispatcher::dispatcher(source& src) : source_(src) {
-    connections_.push_back(src.on_key_pressed.connect([&](key key_id) {
-        // Record press time
-        key_pressed_time_[static_cast<std::size_t>(key_id)] = timer::now();
-        // Forward
-        on_key_pressed(key_pressed_data{key_id});
-    }));
+    connections_.push_back(src.on_key_pressed.connect(
+        [&](key key_id) { on_source_event_(key_pressed_data{key_id}); }));
 
-    connections_.push_back(src.on_key_pressed_repeat.connect([&](key key_id) {
-        // Forward
-        on_key_pressed_repeat(key_pressed_repeat_data{key_id});
-    }));
+    connections_.push_back(src.on_key_pressed_repeat.connect(
+        [&](key key_id) { on_source_event_(key_pressed_repeat_data{key_id}); }));
 
-    connections_.push_back(src.on_key_released.connect([&](key key_id) {
-        // Forward
-        on_key_released(key_released_data{key_id});
-    }));
+    connections_.push_back(src.on_key_released.connect(
+        [&](key key_id) { on_source_event_(key_released_data{key_id}); }));
 
-    connections_.push_back(src.on_text_entered.connect([&](std::uint32_t c) {
-        // Forward
-        on_text_entered(text_entered_data{c});
-    }));
+    connections_.push_back(src.on_text_entered.connect(
+        [&](std::uint32_t c) { on_source_event_(text_entered_data{c}); }));
 
     connections_.push_back(
         src.on_mouse_pressed.connect([&](mouse_button button_id, gui::vector2f mouse_pos) {
-            // Apply scaling factor to mouse coordinates
-            mouse_pos /= scaling_factor_;
-
-            // Record press time
-            auto time_last = mouse_pressed_time_[static_cast<std::size_t>(button_id)];
-            auto time_now  = timer::now();
-            mouse_pressed_time_[static_cast<std::size_t>(button_id)] = time_now;
-            double click_time = std::chrono::duration<double>(time_now - time_last).count();
-
-            // Forward
-            on_mouse_pressed(mouse_pressed_data{button_id, mouse_pos});
-
-            if (click_time < double_click_time_)
-                on_mouse_double_clicked(mouse_double_clicked_data{button_id, mouse_pos});
+            on_source_event_(mouse_pressed_data{button_id, mouse_pos});
         }));
 
     connections_.push_back(
         src.on_mouse_released.connect([&](mouse_button button_id, gui::vector2f mouse_pos) {
-            // Apply scaling factor to mouse coordinates
-            mouse_pos /= scaling_factor_;
-
-            // Forward
-            bool was_dragged = is_mouse_dragged_ && button_id == mouse_drag_button_;
-            on_mouse_released(mouse_released_data{button_id, mouse_pos, was_dragged});
-
-            if (was_dragged) {
-                is_mouse_dragged_ = false;
-                on_mouse_drag_stop(mouse_drag_stop_data{button_id, mouse_pos});
-            }
+            on_source_event_(mouse_released_data{button_id, mouse_pos, false});
         }));
 
     connections_.push_back(src.on_mouse_wheel.connect([&](float wheel, gui::vector2f mouse_pos) {
-        // Apply scaling factor to mouse coordinates
-        mouse_pos /= scaling_factor_;
-        // Forward
-        on_mouse_wheel(mouse_wheel_data{wheel, mouse_pos});
+        on_source_event_(mouse_wheel_data{wheel, mouse_pos});
     }));
 
     connections_.push_back(
         src.on_mouse_moved.connect([&](gui::vector2f movement, gui::vector2f mouse_pos) {
-            // Apply scaling factor to mouse coordinates
-            movement /= scaling_factor_;
-            mouse_pos /= scaling_factor_;
-
-            // Forward
-            on_mouse_moved(mouse_moved_data{movement, mouse_pos});
-
-            if (!is_mouse_dragged_) {
-                std::size_t mouse_button_pressed = std::numeric_limits<std::size_t>::max();
-                for (std::size_t i = 0; i < mouse_button_number; ++i) {
-                    if (mouse_is_down(static_cast<mouse_button>(i))) {
-                        mouse_button_pressed = i;
-                        break;
-                    }
-                }
-
-                if (mouse_button_pressed != std::numeric_limits<std::size_t>::max()) {
-                    is_mouse_dragged_  = true;
-                    mouse_drag_button_ = static_cast<mouse_button>(mouse_button_pressed);
-                    on_mouse_drag_start(mouse_drag_start_data{mouse_drag_button_, mouse_pos});
-                }
-            }
+            on_source_event_(mouse_moved_data{movement, mouse_pos});
         }));
 }
 
+void dispatcher::on_source_event_(event_data data) {
+    const auto time_now = timer::now();
+
+    if (!is_buffered_) {
+        std::visit([&](const auto& event) { process_event_(event, time_now); }, data);
+        return;
+    }
+
+    if (const auto* motion = std::get_if<mouse_moved_data>(&data); motion != nullptr) {
+        // Merge with previous motion, if nothing else happened in between
+        if (!event_queue_.empty()) {
+            auto& last = event_queue_.back();
+            if (auto* last_motion = std::get_if<mouse_moved_data>(&last.data)) {
+                last_motion->motion += motion->motion;
+                last_motion->position = motion->position;
+                last.time             = time_now;
+                return;
+            }
+        }
+    }
+
+    event_queue_.push_back(queued_event{std::move(data), time_now});
+}
+
+void dispatcher::process_events() {
+    if (event_queue_.empty())
+        return;
+
+    // Swap the queue, in case events are received while processing
+    std::vector<queued_event> queue;
+    std::swap(queue, event_queue_);
+
+    for (const auto& event : queue)
+        std::visit([&](const auto& data) { process_event_(data, event.time); }, event.data);
+
+    if (event_queue_.empty()) {
+        // Keep the allocated memory for the next frame
+        queue.clear();
+        std::swap(queue, event_queue_);
+    }
+}
+
+void dispatcher::set_buffered(bool buffered) {
+    if (buffered == is_buffered_)
+        return;
+
+    if (!buffered) {
+        process_events();
+    } else {
+        // The queue is empty: the source state matches the forwarded events
+        key_state_   = source_.get_key_state();
+        mouse_state_ = source_.get_mouse_state();
+    }
+
+    is_buffered_ = buffered;
+}
+
+bool dispatcher::is_buffered() const {
+    return is_buffered_;
+}
+
+void dispatcher::process_event_(const key_pressed_data& data, time_point time) {
+    // Record press time
+    key_pressed_time_[static_cast<std::size_t>(data.key)]       = time;
+    key_state_.is_key_down[static_cast<std::size_t>(data.key)] = true;
+    // Forward
+    on_key_pressed(data);
+}
+
+void dispatcher::process_event_(const key_pressed_repeat_data& data, time_point) {
+    // Forward
+    on_key_pressed_repeat(data);
+}
+
+void dispatcher::process_event_(const key_released_data& data, time_point) {
+    key_state_.is_key_down[static_cast<std::size_t>(data.key)] = false;
+    // Forward
+    on_key_released(data);
+}
+
+void dispatcher::process_event_(const text_entered_data& data, time_point) {
+    // Forward
+    on_text_entered(data);
+}
+
+void dispatcher::process_event_(const mouse_pressed_data& data, time_point time) {
+    // Apply scaling factor to mouse coordinates
+    const auto mouse_pos = data.position / scaling_factor_;
+
+    // Record press time
+    const std::size_t button_index = static_cast<std::size_t>(data.button);
+    auto              time_last    = mouse_pressed_time_[button_index];
+    mouse_pressed_time_[button_index]          = time;
+    mouse_state_.is_button_down[button_index] = true;
+    mouse_state_.position                     = data.position;
+    double click_time = std::chrono::duration<double>(time - time_last).count();
+
+    // Forward
+    on_mouse_pressed(mouse_pressed_data{data.button, mouse_pos});
+
+    if (click_time < double_click_time_)
+        on_mouse_double_clicked(mouse_double_clicked_data{data.button, mouse_pos});
+}
+
+void dispatcher::process_event_(const mouse_released_data& data, time_point) {
+    // Apply scaling factor to mouse coordinates
+    const auto mouse_pos = data.position / scaling_factor_;
+
+    mouse_state_.is_button_down[static_cast<std::size_t>(data.button)] = false;
+    mouse_state_.position                                              = data.position;
+
+    // Forward
+    bool was_dragged = is_mouse_dragged_ && data.button == mouse_drag_button_;
+    on_mouse_released(mouse_released_data{data.button, mouse_pos, was_dragged});
+
+    if (was_dragged) {
+        is_mouse_dragged_ = false;
+        on_mouse_drag_stop(mouse_drag_stop_data{data.button, mouse_pos});
+    }
+}
+
+void dispatcher::process_event_(const mouse_wheel_data& data, time_point) {
+    mouse_state_.wheel += data.motion;
+    mouse_state_.position = data.position;
+
+    // Apply scaling factor to mouse coordinates
+    const auto mouse_pos = data.position / scaling_factor_;
+    // Forward
+    on_mouse_wheel(mouse_wheel_data{data.motion, mouse_pos});
+}
+
+void dispatcher::process_event_(const mouse_moved_data& data, time_point) {
+    mouse_state_.position = data.position;
+
+    // Apply scaling factor to mouse coordinates
+    const auto movement  = data.motion / scaling_factor_;
+    const auto mouse_pos = data.position / scaling_factor_;
+
+    // Forward
+    on_mouse_moved(mouse_moved_data{movement, mouse_pos});
+
+    if (!is_mouse_dragged_) {
+        std::size_t mouse_button_pressed = std::numeric_limits<std::size_t>::max();
+        for (std::size_t i = 0; i < mouse_button_number; ++i) {
+            if (mouse_is_down(static_cast<mouse_button>(i))) {
+                mouse_button_pressed = i;
+                break;
+            }
+        }
+
+        if (mouse_button_pressed != std::numeric_limits<std::size_t>::max()) {
+            is_mouse_dragged_  = true;
+            mouse_drag_button_ = static_cast<mouse_button>(mouse_button_pressed);
+            on_mouse_drag_start(mouse_drag_start_data{mouse_drag_button_, mouse_pos});
+        }
+    }
+}
+
+const source::key_state& dispatcher::get_key_state_() const {
+    // In buffered mode, the state of the source is ahead of the forwarded events
+    return is_buffered_ ? key_state_ : source_.get_key_state();
+}
+
+const source::mouse_state& dispatcher::get_mouse_state_() const {
+    return is_buffered_ ? mouse_state_ : source_.get_mouse_state();
+}
+
 bool dispatcher::any_key_is_down() const {
-    const auto& is_key_down = source_.get_key_state().is_key_down;
+    const auto& is_key_down = get_key_state_().is_key_down;
     for (std::size_t i = 1; i < key_number; ++i) {
         if (is_key_down[i])
             return true;
@@ -113,7 +224,7 @@ bool dispatcher::any_key_is_down() const {
 }
 
 bool dispatcher::key_is_down(key key_id) const {
-    return source_.get_key_state().is_key_down[static_cast<std::size_t>(key_id)];
+    return get_key_state_().is_key_down[static_cast<std::size_t>(key_id)];
 }
 
 double dispatcher::get_key_down_duration(key key_id) const {
@@ -126,7 +237,7 @@ double dispatcher::get_key_down_duration(key key_id) const {
 }
 
 bool dispatcher::mouse_is_down(mouse_button button_id) const {
-    return source_.get_mouse_state().is_button_down[static_cast<std::size_t>(button_id)];
+    return get_mouse_state_().is_button_down[static_cast<std::size_t>(button_id)];
 }
 
 double dispatcher::get_mouse_down_duration(mouse_button button_id) const {
@@ -159,11 +270,11 @@ bool dispatcher::ctrl_is_pressed() const {
 }
 
 gui::vector2f dispatcher::get_mouse_position() const {
-    return source_.get_mouse_state().position / scaling_factor_;
+    return get_mouse_state_().position / scaling_factor_;
 }
 
 float dispatcher::get_mouse_wheel() const {
-    return source_.get_mouse_state().wheel;
+    return get_mouse_state_().wheel;
 }
 
 const source& dispatcher::get_source() const {
@@ -0,0 +1,94 @@
+#include "lxgui/utils_mapped_file.hpp"
+
+#include "lxgui/utils_exception.hpp"
+
+#if defined(LXGUI_PLATFORM_WINDOWS)
+#    define NOMINMAX
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace lxgui::utils {
+
+#if defined(LXGUI_PLATFORM_WINDOWS)
+mapped_file::mapped_file(const std::string& file_name) {
+    HANDLE file = CreateFileA(
+        file_name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throw utils::exception("utils::mapped_file", "Cannot open file '" + file_name + "'.");
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        throw utils::exception("utils::mapped_file", "Cannot read size of '" + file_name + "'.");
+    }
+
+    size_ = static_cast<std::size_t>(size.QuadPart);
+    if (size_ == 0u) {
+        CloseHandle(file);
+        return;
+    }
+
+    // The view keeps the mapping alive, the handles are not needed anymore
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping)
+        throw utils::exception("utils::mapped_file", "Cannot map file '" + file_name + "'.");
+
+    data_ = static_cast<const std::byte*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    CloseHandle(mapping);
+    if (!data_)
+        throw utils::exception("utils::mapped_file", "Cannot map file '" + file_name + "'.");
+}
+
+mapped_file::~mapped_file() {
+    if (data_)
+        UnmapViewOfFile(data_);
+}
+#else
+mapped_file::mapped_file(const std::string& file_name) {
+    int file = ::open(file_name.c_str(), O_RDONLY);
+    if (file < 0)
+        throw utils::exception("utils::mapped_file", "Cannot open file '" + file_name + "'.");
+
+    struct stat info;
+    if (::fstat(file, &info) != 0) {
+        ::close(file);
+        throw utils::exception("utils::mapped_file", "Cannot read size of '" + file_name + "'.");
+    }
+
+    size_ = static_cast<std::size_t>(info.st_size);
+    if (size_ == 0u) {
+        ::close(file);
+        return;
+    }
+
+    // The mapping stays valid after the file is closed
+    void* data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file, 0);
+    ::close(file);
+    if (data == MAP_FAILED)
+        throw utils::exception("utils::mapped_file", "Cannot map file '" + file_name + "'.");
+
+    data_ = static_cast<const std::byte*>(data);
+}
+
+mapped_file::~mapped_file() {
+    if (data_)
+        ::munmap(const_cast<std::byte*>(data_), size_);
+}
+#endif
+
+const std::byte* mapped_file::get_data() const {
+    return data_;
+}
+
+std::size_t mapped_file::get_size() const {
+    return size_;
+}
+
+} // namespace lxgui::utils
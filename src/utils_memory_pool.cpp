@@ -0,0 +1,111 @@
+#include "lxgui/utils_memory_pool.hpp"
+
+#include <algorithm>
+#include <new>
+
+namespace lxgui::utils {
+
+memory_pool::memory_pool(std::size_t block_size, std::size_t blocks_per_chunk) :
+    blocks_per_chunk_(blocks_per_chunk) {
+    // Round up to keep all blocks suitably aligned
+    constexpr std::size_t alignment = alignof(std::max_align_t);
+    block_size_ = std::max(block_size, sizeof(free_block));
+    block_size_ = ((block_size_ + alignment - 1u) / alignment) * alignment;
+}
+
+void* memory_pool::allocate() {
+    if (!free_list_) {
+        // Allocate a new chunk, and split it into free blocks
+        auto chunk = std::make_unique<std::byte[]>(block_size_ * blocks_per_chunk_);
+
+        for (std::size_t i = blocks_per_chunk_; i > 0u; --i) {
+            auto* block = new (chunk.get() + (i - 1u) * block_size_) free_block{free_list_};
+            free_list_  = block;
+        }
+
+        chunk_list_.push_back(std::move(chunk));
+    }
+
+    free_block* block = free_list_;
+    free_list_        = block->next;
+    ++used_block_count_;
+
+    return block;
+}
+
+void memory_pool::deallocate(void* ptr) noexcept {
+    if (!ptr)
+        return;
+
+    free_list_ = new (ptr) free_block{free_list_};
+    --used_block_count_;
+}
+
+bool memory_pool::release() noexcept {
+    if (used_block_count_ != 0u)
+        return false;
+
+    free_list_ = nullptr;
+    chunk_list_.clear();
+    return true;
+}
+
+std::size_t memory_pool::get_block_size() const {
+    return block_size_;
+}
+
+std::size_t memory_pool::get_used_block_count() const {
+    return used_block_count_;
+}
+
+std::size_t memory_pool::get_allocated_size() const {
+    return chunk_list_.size() * blocks_per_chunk_ * block_size_;
+}
+
+memory_pool& memory_arena::get_pool_(std::size_t size) {
+    const std::size_t size_class = (size - 1u) / size_class_step;
+
+    auto& pool = pool_list_[size_class];
+    if (!pool)
+        pool = std::make_unique<memory_pool>((size_class + 1u) * size_class_step);
+
+    return *pool;
+}
+
+void* memory_arena::allocate(std::size_t size, std::size_t alignment) {
+    if (!is_pooled_(size, alignment))
+        return ::operator new(size, std::align_val_t{alignment});
+
+    return get_pool_(size).allocate();
+}
+
+void memory_arena::deallocate(void* ptr, std::size_t size, std::size_t alignment) noexcept {
+    if (!is_pooled_(size, alignment)) {
+        ::operator delete(ptr, std::align_val_t{alignment});
+        return;
+    }
+
+    get_pool_(size).deallocate(ptr);
+}
+
+bool memory_arena::release() noexcept {
+    bool released = true;
+    for (auto& pool : pool_list_) {
+        if (pool && !pool->release())
+            released = false;
+    }
+
+    return released;
+}
+
+std::size_t memory_arena::get_allocated_size() const {
+    std::size_t size = 0u;
+    for (const auto& pool : pool_list_) {
+        if (pool)
+            size += pool->get_allocated_size();
+    }
+
+    return size;
+}
+
+} // namespace lxgui::utils
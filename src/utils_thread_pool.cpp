@@ -0,0 +1,138 @@
+#include "lxgui/utils_thread_pool.hpp"
+
+#include <algorithm>
+
+namespace lxgui::utils {
+
+thread_pool::thread_pool(std::size_t thread_count) {
+    // One queue for the calling thread, and one for each worker
+    for (std::size_t i = 0u; i <= thread_count; ++i)
+        queue_list_.push_back(std::make_unique<range_queue>());
+
+    thread_list_.reserve(thread_count);
+    for (std::size_t i = 0u; i < thread_count; ++i)
+        thread_list_.emplace_back([this, i]() { worker_loop_(i + 1u); });
+}
+
+thread_pool::~thread_pool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+
+    start_condition_.notify_all();
+
+    for (auto& t : thread_list_)
+        t.join();
+}
+
+std::size_t thread_pool::get_thread_count() const {
+    return thread_list_.size();
+}
+
+void thread_pool::parallel_for(std::size_t count, const std::function<void(std::size_t)>& func) {
+    if (count == 0u)
+        return;
+
+    if (thread_list_.empty() || count == 1u) {
+        for (std::size_t i = 0u; i < count; ++i)
+            func(i);
+        return;
+    }
+
+    // Split the loop in a few ranges per thread, so there is something left to steal
+    const std::size_t queue_count = queue_list_.size();
+    const std::size_t range_size  = std::max<std::size_t>(1u, count / (4u * queue_count));
+
+    std::size_t queue_id = 0u;
+    for (std::size_t begin = 0u; begin < count; begin += range_size) {
+        auto& queue = *queue_list_[queue_id];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.range_list.emplace_back(begin, std::min(begin + range_size, count));
+        }
+
+        queue_id = (queue_id + 1u) % queue_count;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        func_       = &func;
+        busy_count_ = thread_list_.size();
+        ++generation_;
+    }
+
+    start_condition_.notify_all();
+
+    run_ranges_(0u, func);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_condition_.wait(lock, [&]() { return busy_count_ == 0u; });
+    func_ = nullptr;
+}
+
+void thread_pool::worker_loop_(std::size_t queue_id) {
+    std::size_t last_generation = 0u;
+
+    while (true) {
+        const std::function<void(std::size_t)>* func = nullptr;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            start_condition_.wait(
+                lock, [&]() { return stop_ || generation_ != last_generation; });
+
+            if (stop_)
+                return;
+
+            last_generation = generation_;
+            func            = func_;
+        }
+
+        run_ranges_(queue_id, *func);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --busy_count_;
+        }
+
+        done_condition_.notify_all();
+    }
+}
+
+void thread_pool::run_ranges_(std::size_t queue_id, const std::function<void(std::size_t)>& func) {
+    range r;
+    while (pop_range_(queue_id, r)) {
+        for (std::size_t i = r.first; i < r.second; ++i)
+            func(i);
+    }
+}
+
+bool thread_pool::pop_range_(std::size_t queue_id, range& r) {
+    // Take from our own queue first
+    {
+        auto&                       queue = *queue_list_[queue_id];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.range_list.empty()) {
+            r = queue.range_list.back();
+            queue.range_list.pop_back();
+            return true;
+        }
+    }
+
+    // Then steal from the other queues
+    const std::size_t queue_count = queue_list_.size();
+    for (std::size_t offset = 1u; offset < queue_count; ++offset) {
+        auto&                       queue = *queue_list_[(queue_id + offset) % queue_count];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.range_list.empty()) {
+            r = queue.range_list.front();
+            queue.range_list.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace lxgui::utils
@@ -4,6 +4,7 @@
 #include "lxgui/gui_edit_box.hpp"
 #include "lxgui/gui_factory.hpp"
 #include "lxgui/gui_font_string.hpp"
+#include "lxgui/gui_list_view.hpp"
 #include "lxgui/gui_localizer.hpp"
 #include "lxgui/gui_manager.hpp"
 #include "lxgui/gui_out.hpp"
@@ -71,10 +72,12 @@
 #    include <emscripten.h>
 #endif
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <fstream>
 #include <thread>
+#include <vector>
 
 using namespace lxgui;
 using timing_clock = std::chrono::high_resolution_clock;
@@ -220,9 +223,121 @@ void main_loop(void* type_erased_data) {
 #endif
 }
 
-int main(int /*argc*/, char* /*argv*/[]) {
+bool check_memory_arena(gui::manager& manager) {
+    // Frame containers (lists of children and regions, scripts) are allocated from the
+    // manager's memory arena. Memory released by destroyed frames is re-used by new frames,
+    // so the arena should not grow after the first batch.
+    const utils::memory_arena& arena = manager.get_memory_arena();
+
+    auto create_and_destroy_frames = [&]() {
+        for (std::size_t i = 0u; i < 50u; ++i) {
+            auto obj = manager.get_root().create_root_frame<gui::frame>(
+                "ArenaTestFrame" + utils::to_string(i));
+            obj->create_child<gui::frame>("$parentChild")->notify_loaded();
+            obj->create_layered_region<gui::texture>(gui::layer::artwork, "$parentTex")
+                ->notify_loaded();
+            obj->add_script("OnUpdate", [](gui::frame&, const gui::event_data&) {});
+            obj->notify_loaded();
+            obj->destroy();
+        }
+
+        manager.get_root().garbage_collect();
+    };
+
+    create_and_destroy_frames();
+    const std::size_t first_size = arena.get_allocated_size();
+
+    for (std::size_t i = 0u; i < 2u; ++i)
+        create_and_destroy_frames();
+
+    if (arena.get_allocated_size() != first_size) {
+        gui::out << gui::error << "Memory arena grew from " << first_size << " to "
+                 << arena.get_allocated_size() << " bytes." << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool check_parallel_layout(gui::manager& manager) {
+    // Resize an anchored grid with and without layout worker threads. Each cell of the grid
+    // only depends on the grid frame, and each inner frame only depends on its cell: each level
+    // of the anchor graph has enough independent regions to be computed in parallel. The
+    // resulting borders must not depend on the thread count.
+    gui::root&            root      = manager.get_root();
+    constexpr std::size_t grid_size = 12u;
+    const float           step      = 1.0f / static_cast<float>(grid_size);
+
+    auto grid = root.create_root_frame<gui::frame>("LayoutTestGrid");
+    grid->set_anchor(gui::point::top_left);
+    grid->set_dimensions(gui::vector2f(300.0f, 300.0f));
+
+    std::vector<utils::observer_ptr<gui::frame>> grid_frame_list;
+    for (std::size_t i = 0u; i < grid_size; ++i) {
+        for (std::size_t j = 0u; j < grid_size; ++j) {
+            const gui::vector2f cell_pos(j * step, i * step);
+
+            auto cell = grid->create_child<gui::frame>(
+                "$parentCell" + utils::to_string(i * grid_size + j));
+            cell->set_anchor(gui::point::top_left, "$parent", cell_pos, gui::anchor_type::rel);
+            cell->set_anchor(
+                gui::point::bottom_right, "$parent",
+                cell_pos + gui::vector2f(step - 1.0f, step - 1.0f), gui::anchor_type::rel);
+            cell->notify_loaded();
+
+            auto inner = cell->create_child<gui::frame>("$parentInner");
+            inner->set_anchor(gui::point::top_left, gui::vector2f(1.0f, 1.0f));
+            inner->set_anchor(gui::point::bottom_right, gui::vector2f(-1.0f, -1.0f));
+            inner->notify_loaded();
+
+            grid_frame_list.push_back(cell);
+            grid_frame_list.push_back(inner);
+        }
+    }
+
+    grid->notify_loaded();
+
+    auto layout_grid = [&](std::size_t thread_count) {
+        root.set_layout_thread_count(thread_count);
+
+        std::vector<gui::bounds2f> border_list;
+        for (const float width : {437.0f, 301.0f}) {
+            root.begin_layout_batch();
+            grid->set_dimensions(gui::vector2f(width, 0.75f * width));
+            root.end_layout_batch();
+
+            for (const auto& obj : grid_frame_list)
+                border_list.push_back(obj->get_borders());
+        }
+
+        return border_list;
+    };
+
+    const std::size_t thread_count =
+        std::max<std::size_t>(std::thread::hardware_concurrency(), 2u) - 1u;
+
+    const auto serial_border_list   = layout_grid(0u);
+    const auto parallel_border_list = layout_grid(thread_count);
+
+    root.set_layout_thread_count(0u);
+    grid->destroy();
+    root.garbage_collect();
+
+    if (serial_border_list != parallel_border_list) {
+        gui::out << gui::error << "Parallel layout (" << thread_count << " threads) "
+                 << "differs from serial layout." << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[]) {
     auto* old_cout_buffer = std::cout.rdbuf();
 
+    // Run internal checks after loading the GUI, instead of entering the main loop
+    const bool run_self_test = argc > 1 && std::string(argv[1]) == "--self-test";
+
     try {
         // -------------------------------------------------
         // Read test configuration
@@ -422,6 +537,7 @@ int main(int /*argc*/, char* /*argv*/[]) {
         fac.register_region_type<gui::slider>();
         fac.register_region_type<gui::edit_box>();
         fac.register_region_type<gui::scroll_frame>();
+        fac.register_region_type<gui::list_view>();
         fac.register_region_type<gui::status_bar>();
 
         // Load files:
@@ -535,6 +651,20 @@ int main(int /*argc*/, char* /*argv*/[]) {
         // Tell the Frame is has been fully loaded, and call "OnLoad"
         fps_frame->notify_loaded();
 
+        // -------------------------------------------------
+        // Self-test (only with --self-test)
+        // -------------------------------------------------
+
+        if (run_self_test) {
+            bool success = true;
+            success      = check_memory_arena(*manager) && success;
+            success      = check_parallel_layout(*manager) && success;
+
+            std::cout << (success ? "Self-test passed." : "Self-test failed.") << std::endl;
+            std::cout.rdbuf(old_cout_buffer);
+            return success ? 0 : 1;
+        }
+
         // -------------------------------------------------
         // Reacting to inputs in your game
         // -------------------------------------------------
@@ -0,0 +1,56 @@
+#include <lxgui/gui_exception.hpp>
+#include <lxgui/gui_texture_file.hpp>
+
+#include <iostream>
+#include <string>
+
+using namespace lxgui;
+
+namespace {
+
+bool check_valid_file(const std::string& file_name) {
+    // A 32x32 texture stored with all its mipmap levels
+    const gui::texture_file file(file_name);
+
+    if (file.get_dimensions() != gui::vector2ui(32u, 32u) || file.get_num_levels() != 6u ||
+        file.get_level_dimensions(5u) != gui::vector2ui(1u, 1u)) {
+        std::cout << "Unexpected content in '" << file_name << "'." << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool check_overflowing_file(const std::string& file_name) {
+    // The header declares 2^31 x 2^31 pixels of 4 bytes: the size of the pixel data wraps
+    // to zero on 64-bit platforms, and would match the size of the file
+    try {
+        const gui::texture_file file(file_name);
+    } catch (const gui::exception&) {
+        return true;
+    }
+
+    std::cout << "Invalid file '" << file_name << "' was not rejected." << std::endl;
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cout << "Usage: " << argv[0] << " <valid .lxtex file> <overflowing .lxtex file>"
+                  << std::endl;
+        return 1;
+    }
+
+    try {
+        bool success = true;
+        success      = check_valid_file(argv[1]) && success;
+        success      = check_overflowing_file(argv[2]) && success;
+
+        return success ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,281 @@
+// lxgui-atlas-bake: packs the textures of an addon into pre-built atlas pages.
+//
+// Usage: lxgui-atlas-bake <addon_directory> [--page-size <pixels>]
+//
+// All the PNG files found in the addon directory (and its sub-directories) are packed
+// into as few atlas pages as possible. The pages are written in the addon directory as
+// "atlas_<n>.png", along with a manifest "atlas.lxatlas" listing the location of each
+// texture. When the addon is loaded, the pages are loaded directly in the texture atlas
+// (see gui::atlas::load_baked_pages()), instead of loading and packing each texture.
+
+#include <png.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Must match the padding used by gui::atlas_page
+constexpr std::uint32_t padding = 1u;
+
+struct image {
+    std::string               name;
+    std::uint32_t             width  = 0u;
+    std::uint32_t             height = 0u;
+    std::vector<std::uint8_t> pixels;
+
+    std::size_t   page = 0u;
+    std::uint32_t left = 0u;
+    std::uint32_t top  = 0u;
+};
+
+struct shelf {
+    std::uint32_t top       = 0u;
+    std::uint32_t height    = 0u;
+    std::uint32_t next_left = 0u;
+};
+
+struct page {
+    std::vector<shelf> shelf_list;
+    std::uint32_t      width  = 0u;
+    std::uint32_t      height = 0u;
+};
+
+bool load_png(const std::filesystem::path& file, image& img) {
+    png_image png;
+    std::memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+
+    if (!png_image_begin_read_from_file(&png, file.string().c_str())) {
+        std::cerr << "warning: cannot read '" << file.string() << "': " << png.message
+                  << std::endl;
+        return false;
+    }
+
+    // Straight (non pre-multiplied) alpha; back-ends pre-multiply pages when loading them
+    png.format = PNG_FORMAT_RGBA;
+
+    img.width  = png.width;
+    img.height = png.height;
+    img.pixels.resize(PNG_IMAGE_SIZE(png));
+
+    if (!png_image_finish_read(&png, nullptr, img.pixels.data(), 0, nullptr)) {
+        std::cerr << "warning: cannot decode '" << file.string() << "': " << png.message
+                  << std::endl;
+        png_image_free(&png);
+        return false;
+    }
+
+    return true;
+}
+
+bool save_png(const std::filesystem::path& file, const page& pg, const std::uint8_t* pixels) {
+    png_image png;
+    std::memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+    png.width   = pg.width;
+    png.height  = pg.height;
+    png.format  = PNG_FORMAT_RGBA;
+
+    if (!png_image_write_to_file(&png, file.string().c_str(), 0, pixels, 0, nullptr)) {
+        std::cerr << "error: cannot write '" << file.string() << "': " << png.message
+                  << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool is_baked_page(const std::filesystem::path& relative_path) {
+    const std::string name = relative_path.generic_string();
+    return name.find('/') == std::string::npos && name.rfind("atlas_", 0) == 0;
+}
+
+bool try_insert(page& pg, image& img, std::uint32_t page_size) {
+    const std::uint32_t width  = img.width + padding;
+    const std::uint32_t height = img.height + padding;
+
+    for (auto& s : pg.shelf_list) {
+        if (height <= s.height && s.next_left + width <= page_size) {
+            img.left = s.next_left;
+            img.top  = s.top;
+            s.next_left += width;
+            pg.width = std::max(pg.width, img.left + img.width);
+            return true;
+        }
+    }
+
+    const std::uint32_t bottom = pg.shelf_list.empty()
+                                     ? 0u
+                                     : pg.shelf_list.back().top + pg.shelf_list.back().height;
+
+    // The top-left pixel of each page is reserved for a white pixel
+    const std::uint32_t left = pg.shelf_list.empty() ? 1u + padding : 0u;
+    if (bottom + height > page_size || left + width > page_size)
+        return false;
+
+    pg.shelf_list.push_back({bottom, height, left + width});
+
+    img.left  = left;
+    img.top   = bottom;
+    pg.width  = std::max(pg.width, img.left + img.width);
+    pg.height = std::max(pg.height, img.top + img.height);
+    return true;
+}
+
+void print_usage() {
+    std::cout << "usage: lxgui-atlas-bake <addon_directory> [--page-size <pixels>]" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::filesystem::path directory;
+    std::uint32_t         page_size = 4096u;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--page-size" && i + 1 < argc) {
+            page_size = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--help" || arg == "-h") {
+            print_usage();
+            return 0;
+        } else if (directory.empty()) {
+            directory = arg;
+        } else {
+            print_usage();
+            return 1;
+        }
+    }
+
+    if (directory.empty() || page_size < 2u) {
+        print_usage();
+        return 1;
+    }
+
+    if (!std::filesystem::is_directory(directory)) {
+        std::cerr << "error: '" << directory.string() << "' is not a directory" << std::endl;
+        return 1;
+    }
+
+    // Gather textures, with names relative to the addon directory
+    std::vector<image> image_list;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(directory)) {
+        if (!entry.is_regular_file() || entry.path().extension() != ".png")
+            continue;
+
+        const auto relative_path = std::filesystem::relative(entry.path(), directory);
+        if (is_baked_page(relative_path))
+            continue;
+
+        image img;
+        img.name = relative_path.generic_string();
+        if (!load_png(entry.path(), img))
+            continue;
+
+        // On an empty page, the first shelf starts after the white pixel and its padding
+        if (img.width + 2u * padding + 1u > page_size || img.height + padding > page_size) {
+            std::cerr << "warning: '" << img.name << "' does not fit in an atlas page, skipped"
+                      << std::endl;
+            continue;
+        }
+
+        image_list.push_back(std::move(img));
+    }
+
+    if (image_list.empty()) {
+        std::cerr << "error: no texture found in '" << directory.string() << "'" << std::endl;
+        return 1;
+    }
+
+    // Pack the tallest textures first; sort by name first, so the output is deterministic
+    std::sort(image_list.begin(), image_list.end(), [](const image& i1, const image& i2) {
+        return i1.name < i2.name;
+    });
+
+    std::stable_sort(image_list.begin(), image_list.end(), [](const image& i1, const image& i2) {
+        return i1.height > i2.height;
+    });
+
+    std::vector<page> page_list;
+    for (auto iter = image_list.begin(); iter != image_list.end();) {
+        auto& img      = *iter;
+        bool  inserted = false;
+        for (std::size_t p = 0u; p < page_list.size() && !inserted; ++p) {
+            if (try_insert(page_list[p], img, page_size)) {
+                img.page = p;
+                inserted = true;
+            }
+        }
+
+        if (!inserted) {
+            page_list.emplace_back();
+            if (!try_insert(page_list.back(), img, page_size)) {
+                page_list.pop_back();
+                std::cerr << "warning: '" << img.name
+                          << "' does not fit in an atlas page, skipped" << std::endl;
+                iter = image_list.erase(iter);
+                continue;
+            }
+
+            img.page = page_list.size() - 1u;
+        }
+
+        ++iter;
+    }
+
+    std::ofstream manifest(directory / "atlas.lxatlas");
+    if (!manifest.is_open()) {
+        std::cerr << "error: cannot write '" << (directory / "atlas.lxatlas").string() << "'"
+                  << std::endl;
+        return 1;
+    }
+
+    manifest << "# lxgui atlas manifest, generated by lxgui-atlas-bake" << std::endl;
+    manifest << "# page <file>" << std::endl;
+    manifest << "# <left> <top> <width> <height> <file>" << std::endl;
+
+    for (std::size_t p = 0u; p < page_list.size(); ++p) {
+        const page& pg = page_list[p];
+
+        std::vector<std::uint8_t> pixels(std::size_t(pg.width) * pg.height * 4u, 0u);
+
+        // White pixel, see gui::atlas
+        std::fill(pixels.begin(), pixels.begin() + 4, std::uint8_t(255u));
+
+        const std::string page_file = "atlas_" + std::to_string(p) + ".png";
+        manifest << "page " << page_file << std::endl;
+
+        for (const auto& img : image_list) {
+            if (img.page != p)
+                continue;
+
+            for (std::uint32_t y = 0u; y < img.height; ++y) {
+                std::copy_n(
+                    img.pixels.data() + std::size_t(y) * img.width * 4u, img.width * 4u,
+                    pixels.data() + (std::size_t(img.top + y) * pg.width + img.left) * 4u);
+            }
+
+            manifest << img.left << " " << img.top << " " << img.width << " " << img.height
+                     << " " << img.name << std::endl;
+        }
+
+        if (!save_png(directory / page_file, pg, pixels.data()))
+            return 1;
+
+        std::cout << page_file << ": " << pg.width << "x" << pg.height << std::endl;
+    }
+
+    std::cout << image_list.size() << " textures packed in " << page_list.size() << " page(s)"
+              << std::endl;
+
+    return 0;
+}
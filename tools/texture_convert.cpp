@@ -0,0 +1,172 @@
+// lxgui-texture-convert: converts PNG textures into raw texture files (.lxtex).
+//
+// Usage: lxgui-texture-convert [--mipmaps] <file.png>...
+//
+// Each PNG file is decoded, its pixels are pre-multiplied by alpha, and the result is
+// written next to it with the .lxtex extension (see gui::texture_file). With --mipmaps,
+// all the mipmap levels are pre-computed and stored in the file as well. When the GUI
+// loads a texture, it loads the .lxtex file instead, if it exists and is not older than
+// the PNG file.
+
+#include <lxgui/gui_texture_file.hpp>
+
+#include <png.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace lxgui;
+
+namespace {
+
+struct level {
+    std::size_t               width  = 0u;
+    std::size_t               height = 0u;
+    std::vector<std::uint8_t> pixels;
+};
+
+bool load_png(const std::string& file_name, level& lvl) {
+    png_image png;
+    std::memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+
+    if (!png_image_begin_read_from_file(&png, file_name.c_str())) {
+        std::cerr << "error: cannot read '" << file_name << "': " << png.message << std::endl;
+        return false;
+    }
+
+    png.format = PNG_FORMAT_RGBA;
+
+    lvl.width  = png.width;
+    lvl.height = png.height;
+    lvl.pixels.resize(PNG_IMAGE_SIZE(png));
+
+    if (!png_image_finish_read(&png, nullptr, lvl.pixels.data(), 0, nullptr)) {
+        std::cerr << "error: cannot decode '" << file_name << "': " << png.message << std::endl;
+        png_image_free(&png);
+        return false;
+    }
+
+    return true;
+}
+
+void premultiply_alpha(level& lvl) {
+    // Same as the run-time conversion, see gui::gl::material::premultiply_alpha()
+    for (std::size_t i = 0u; i < lvl.pixels.size(); i += 4u) {
+        const float a = lvl.pixels[i + 3u] / 255.0f;
+        for (std::size_t c = 0u; c < 3u; ++c)
+            lvl.pixels[i + c] = static_cast<std::uint8_t>(lvl.pixels[i + c] * a);
+    }
+}
+
+level downsample(const level& src) {
+    level dst;
+    dst.width  = std::max<std::size_t>(src.width / 2u, 1u);
+    dst.height = std::max<std::size_t>(src.height / 2u, 1u);
+    dst.pixels.resize(dst.width * dst.height * 4u);
+
+    // Box filter; averaging pre-multiplied pixels does not bleed transparent colors
+    for (std::size_t y = 0u; y < dst.height; ++y) {
+        const std::size_t y0 = std::min(y * 2u, src.height - 1u);
+        const std::size_t y1 = std::min(y * 2u + 1u, src.height - 1u);
+        for (std::size_t x = 0u; x < dst.width; ++x) {
+            const std::size_t x0 = std::min(x * 2u, src.width - 1u);
+            const std::size_t x1 = std::min(x * 2u + 1u, src.width - 1u);
+            for (std::size_t c = 0u; c < 4u; ++c) {
+                const unsigned int sum = src.pixels[(y0 * src.width + x0) * 4u + c] +
+                                         src.pixels[(y0 * src.width + x1) * 4u + c] +
+                                         src.pixels[(y1 * src.width + x0) * 4u + c] +
+                                         src.pixels[(y1 * src.width + x1) * 4u + c];
+
+                dst.pixels[(y * dst.width + x) * 4u + c] =
+                    static_cast<std::uint8_t>((sum + 2u) / 4u);
+            }
+        }
+    }
+
+    return dst;
+}
+
+bool convert(const std::string& file_name, bool with_mipmaps) {
+    std::vector<level> level_list(1u);
+    if (!load_png(file_name, level_list[0]))
+        return false;
+
+    premultiply_alpha(level_list[0]);
+
+    if (with_mipmaps) {
+        while (level_list.back().width > 1u || level_list.back().height > 1u)
+            level_list.push_back(downsample(level_list.back()));
+    }
+
+    gui::texture_file::header head;
+    head.width      = static_cast<std::uint32_t>(level_list[0].width);
+    head.height     = static_cast<std::uint32_t>(level_list[0].height);
+    head.num_levels = static_cast<std::uint32_t>(level_list.size());
+    head.flags      = gui::texture_file::premultiplied_alpha;
+
+    const std::string output_name = gui::texture_file::get_file_name(file_name);
+    std::ofstream     output(output_name, std::ios::binary);
+    if (!output.is_open()) {
+        std::cerr << "error: cannot write '" << output_name << "'" << std::endl;
+        return false;
+    }
+
+    output.write(reinterpret_cast<const char*>(&head), sizeof(head));
+    for (const auto& lvl : level_list) {
+        output.write(
+            reinterpret_cast<const char*>(lvl.pixels.data()),
+            static_cast<std::streamsize>(lvl.pixels.size()));
+    }
+
+    if (!output.good()) {
+        std::cerr << "error: cannot write '" << output_name << "'" << std::endl;
+        return false;
+    }
+
+    std::cout << file_name << " -> " << output_name << " (" << head.width << "x" << head.height
+              << ", " << head.num_levels << " level(s))" << std::endl;
+
+    return true;
+}
+
+void print_usage() {
+    std::cout << "usage: lxgui-texture-convert [--mipmaps] <file.png>..." << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    bool                     with_mipmaps = false;
+    std::vector<std::string> file_list;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--mipmaps") {
+            with_mipmaps = true;
+        } else if (arg == "--help" || arg == "-h") {
+            print_usage();
+            return 0;
+        } else {
+            file_list.push_back(arg);
+        }
+    }
+
+    if (file_list.empty()) {
+        print_usage();
+        return 1;
+    }
+
+    bool success = true;
+    for (const auto& file_name : file_list) {
+        if (!convert(file_name, with_mipmaps))
+            success = false;
+    }
+
+    return success ? 0 : 1;
+}